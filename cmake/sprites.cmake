@@ -0,0 +1,260 @@
+# Compile images into sprite blobs at build time
+# Date 2026-10-18
+# Copyright nubix Software-Design GmbH 2026
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+get_filename_component(SPRITE_COMPILER ${CMAKE_CURRENT_LIST_DIR}/../utils/sprite_compiler.py ABSOLUTE)
+get_filename_component(ATLAS_PACKER ${CMAKE_CURRENT_LIST_DIR}/../utils/atlas_packer.py ABSOLUTE)
+get_filename_component(ANIMATION_COMPILER ${CMAKE_CURRENT_LIST_DIR}/../utils/animation_compiler.py ABSOLUTE)
+get_filename_component(VIDEO_COMPILER ${CMAKE_CURRENT_LIST_DIR}/../utils/video_compiler.py ABSOLUTE)
+get_filename_component(ASSET_PACKER ${CMAKE_CURRENT_LIST_DIR}/../utils/asset_packer.py ABSOLUTE)
+get_filename_component(LEVEL_COMPILER ${CMAKE_CURRENT_LIST_DIR}/../utils/from_unity.py ABSOLUTE)
+
+# sprite_producer(PRODUCER OUTPUT [...])
+# Remembers the custom target building the OUTPUT files, so asset_pack() waits
+# for it instead of running the same command a second time in parallel.
+function(sprite_producer PRODUCER)
+    foreach(FILE ${ARGN})
+        set_property(GLOBAL PROPERTY SPRITE_PRODUCER_${FILE} ${PRODUCER})
+    endforeach()
+endfunction()
+
+# sprite_compile(TARGET SOURCE IMAGE OUTPUT FORMAT [RLE|QOI])
+# Converts IMAGE into ${CMAKE_CURRENT_BINARY_DIR}/sprites/OUTPUT with the pixel
+# FORMAT (see PixelFormat), raw or encoded with RLE or QOI. SOURCE is the file
+# including the blob with INCBIN, it is rebuilt when the blob changes.
+function(sprite_compile TARGET SOURCE IMAGE OUTPUT FORMAT)
+    get_filename_component(SPRITE_IMAGE ${IMAGE} ABSOLUTE)
+    set(SPRITE_DIR ${CMAKE_CURRENT_BINARY_DIR}/sprites)
+    set(SPRITE_OUTPUT ${SPRITE_DIR}/${OUTPUT})
+    set(SPRITE_OPTIONS -f ${FORMAT})
+    if("RLE" IN_LIST ARGN)
+        list(APPEND SPRITE_OPTIONS --rle)
+    elseif("QOI" IN_LIST ARGN)
+        list(APPEND SPRITE_OPTIONS --qoi)
+    endif()
+
+    get_filename_component(SPRITE_OUTPUT_DIR ${SPRITE_OUTPUT} DIRECTORY)
+    add_custom_command(OUTPUT ${SPRITE_OUTPUT}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${SPRITE_OUTPUT_DIR}
+        COMMAND ${Python3_EXECUTABLE} ${SPRITE_COMPILER} ${SPRITE_OPTIONS}
+                ${SPRITE_IMAGE} ${SPRITE_OUTPUT}
+        DEPENDS ${SPRITE_IMAGE} ${SPRITE_COMPILER}
+        COMMENT "Compiling sprite ${OUTPUT}"
+    )
+
+    # not added to the sources, format_code() would run on the blob
+    string(MAKE_C_IDENTIFIER "${TARGET}_sprite_${OUTPUT}" SPRITE_TARGET)
+    add_custom_target(${SPRITE_TARGET} DEPENDS ${SPRITE_OUTPUT})
+    add_dependencies(${TARGET} ${SPRITE_TARGET})
+    sprite_producer(${SPRITE_TARGET} ${SPRITE_OUTPUT})
+
+    # INCBIN is not seen by the dependency scanner
+    set_property(SOURCE ${SOURCE} APPEND PROPERTY OBJECT_DEPENDS ${SPRITE_OUTPUT})
+    target_include_directories(${TARGET} PRIVATE ${SPRITE_DIR})
+endfunction()
+
+# sprite_atlas(TARGET SOURCE NAME FORMAT [RLE|QOI] IMAGES SPRITE=IMAGE [...])
+# Packs all IMAGES into ${CMAKE_CURRENT_BINARY_DIR}/sprites/NAME.sprite and
+# generates NAME.hpp with the NAMERect enum and the kNAMERects table, the
+# SPRITE names become the enum values.
+function(sprite_atlas TARGET SOURCE NAME FORMAT)
+    cmake_parse_arguments(ATLAS "RLE;QOI" "" "IMAGES" ${ARGN})
+    set(SPRITE_DIR ${CMAKE_CURRENT_BINARY_DIR}/sprites)
+    set(ATLAS_OUTPUTS ${SPRITE_DIR}/${NAME}.sprite ${SPRITE_DIR}/${NAME}.hpp)
+    set(ATLAS_OPTIONS -f ${FORMAT})
+    if(ATLAS_RLE)
+        list(APPEND ATLAS_OPTIONS --rle)
+    elseif(ATLAS_QOI)
+        list(APPEND ATLAS_OPTIONS --qoi)
+    endif()
+
+    set(ATLAS_ENTRIES)
+    set(ATLAS_DEPENDS)
+    foreach(ENTRY ${ATLAS_IMAGES})
+        string(REPLACE "=" ";" ENTRY_PARTS ${ENTRY})
+        list(GET ENTRY_PARTS 0 ENTRY_NAME)
+        list(GET ENTRY_PARTS 1 ENTRY_IMAGE)
+        get_filename_component(ENTRY_IMAGE ${ENTRY_IMAGE} ABSOLUTE)
+        list(APPEND ATLAS_ENTRIES ${ENTRY_NAME}=${ENTRY_IMAGE})
+        list(APPEND ATLAS_DEPENDS ${ENTRY_IMAGE})
+    endforeach()
+
+    add_custom_command(OUTPUT ${ATLAS_OUTPUTS}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${SPRITE_DIR}
+        COMMAND ${Python3_EXECUTABLE} ${ATLAS_PACKER} ${ATLAS_OPTIONS}
+                ${NAME} ${SPRITE_DIR} ${ATLAS_ENTRIES}
+        DEPENDS ${ATLAS_DEPENDS} ${ATLAS_PACKER} ${SPRITE_COMPILER}
+        COMMENT "Packing sprite atlas ${NAME}"
+    )
+
+    string(MAKE_C_IDENTIFIER "${TARGET}_atlas_${NAME}" ATLAS_TARGET)
+    add_custom_target(${ATLAS_TARGET} DEPENDS ${ATLAS_OUTPUTS})
+    add_dependencies(${TARGET} ${ATLAS_TARGET})
+    sprite_producer(${ATLAS_TARGET} ${ATLAS_OUTPUTS})
+
+    set_property(SOURCE ${SOURCE} APPEND PROPERTY OBJECT_DEPENDS ${ATLAS_OUTPUTS})
+    target_include_directories(${TARGET} PRIVATE ${SPRITE_DIR})
+endfunction()
+
+# sprite_animation(TARGET SOURCE OUTPUT FORMAT [DURATION MS] IMAGES IMAGE [...])
+# Compiles the frames of IMAGES into ${CMAKE_CURRENT_BINARY_DIR}/sprites/OUTPUT
+# for AnimatedSprite::load(). An animated image holds all its frames; DURATION
+# sets the time of every frame instead of the one stored in the images.
+function(sprite_animation TARGET SOURCE OUTPUT FORMAT)
+    cmake_parse_arguments(ANIMATION "" "DURATION" "IMAGES" ${ARGN})
+    set(SPRITE_DIR ${CMAKE_CURRENT_BINARY_DIR}/sprites)
+    set(ANIMATION_OUTPUT ${SPRITE_DIR}/${OUTPUT})
+    set(ANIMATION_OPTIONS -f ${FORMAT})
+    if(ANIMATION_DURATION)
+        list(APPEND ANIMATION_OPTIONS --duration ${ANIMATION_DURATION})
+    endif()
+
+    set(ANIMATION_FRAMES)
+    foreach(FRAME ${ANIMATION_IMAGES})
+        get_filename_component(FRAME ${FRAME} ABSOLUTE)
+        list(APPEND ANIMATION_FRAMES ${FRAME})
+    endforeach()
+
+    get_filename_component(ANIMATION_OUTPUT_DIR ${ANIMATION_OUTPUT} DIRECTORY)
+    add_custom_command(OUTPUT ${ANIMATION_OUTPUT}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${ANIMATION_OUTPUT_DIR}
+        COMMAND ${Python3_EXECUTABLE} ${ANIMATION_COMPILER} ${ANIMATION_OPTIONS}
+                ${ANIMATION_OUTPUT} ${ANIMATION_FRAMES}
+        DEPENDS ${ANIMATION_FRAMES} ${ANIMATION_COMPILER} ${SPRITE_COMPILER}
+        COMMENT "Compiling animation ${OUTPUT}"
+    )
+
+    string(MAKE_C_IDENTIFIER "${TARGET}_animation_${OUTPUT}" ANIMATION_TARGET)
+    add_custom_target(${ANIMATION_TARGET} DEPENDS ${ANIMATION_OUTPUT})
+    add_dependencies(${TARGET} ${ANIMATION_TARGET})
+    sprite_producer(${ANIMATION_TARGET} ${ANIMATION_OUTPUT})
+
+    set_property(SOURCE ${SOURCE} APPEND PROPERTY OBJECT_DEPENDS ${ANIMATION_OUTPUT})
+    target_include_directories(${TARGET} PRIVATE ${SPRITE_DIR})
+endfunction()
+
+# sprite_video(TARGET SOURCE OUTPUT FORMAT [RATE FPS] [TOLERANCE BITS] IMAGES IMAGE [...])
+# Compiles the frames of IMAGES into ${CMAKE_CURRENT_BINARY_DIR}/sprites/OUTPUT
+# for Video::load(), played with RATE frames per second (default 30). Blocks
+# differing by up to TOLERANCE in each channel are not updated (default 0).
+function(sprite_video TARGET SOURCE OUTPUT FORMAT)
+    cmake_parse_arguments(VIDEO "" "RATE;TOLERANCE" "IMAGES" ${ARGN})
+    set(SPRITE_DIR ${CMAKE_CURRENT_BINARY_DIR}/sprites)
+    set(VIDEO_OUTPUT ${SPRITE_DIR}/${OUTPUT})
+    set(VIDEO_OPTIONS -f ${FORMAT})
+    if(VIDEO_RATE)
+        list(APPEND VIDEO_OPTIONS --rate ${VIDEO_RATE})
+    endif()
+    if(VIDEO_TOLERANCE)
+        list(APPEND VIDEO_OPTIONS --tolerance ${VIDEO_TOLERANCE})
+    endif()
+
+    set(VIDEO_FRAMES)
+    foreach(FRAME ${VIDEO_IMAGES})
+        get_filename_component(FRAME ${FRAME} ABSOLUTE)
+        list(APPEND VIDEO_FRAMES ${FRAME})
+    endforeach()
+
+    get_filename_component(VIDEO_OUTPUT_DIR ${VIDEO_OUTPUT} DIRECTORY)
+    add_custom_command(OUTPUT ${VIDEO_OUTPUT}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${VIDEO_OUTPUT_DIR}
+        COMMAND ${Python3_EXECUTABLE} ${VIDEO_COMPILER} ${VIDEO_OPTIONS}
+                ${VIDEO_OUTPUT} ${VIDEO_FRAMES}
+        DEPENDS ${VIDEO_FRAMES} ${VIDEO_COMPILER} ${SPRITE_COMPILER}
+        COMMENT "Compiling video ${OUTPUT}"
+    )
+
+    string(MAKE_C_IDENTIFIER "${TARGET}_video_${OUTPUT}" VIDEO_TARGET)
+    add_custom_target(${VIDEO_TARGET} DEPENDS ${VIDEO_OUTPUT})
+    add_dependencies(${TARGET} ${VIDEO_TARGET})
+    sprite_producer(${VIDEO_TARGET} ${VIDEO_OUTPUT})
+
+    set_property(SOURCE ${SOURCE} APPEND PROPERTY OBJECT_DEPENDS ${VIDEO_OUTPUT})
+    target_include_directories(${TARGET} PRIVATE ${SPRITE_DIR})
+endfunction()
+
+# level_compile(TARGET SOURCE CSV OUTPUT [PIXELS])
+# Converts the map CSV into ${CMAKE_CURRENT_BINARY_DIR}/sprites/OUTPUT for
+# Level::Load(). The coordinates are Unity units, or world pixels with PIXELS.
+function(level_compile TARGET SOURCE CSV OUTPUT)
+    get_filename_component(LEVEL_CSV ${CSV} ABSOLUTE)
+    set(SPRITE_DIR ${CMAKE_CURRENT_BINARY_DIR}/sprites)
+    set(LEVEL_OUTPUT ${SPRITE_DIR}/${OUTPUT})
+    set(LEVEL_OPTIONS)
+    if("PIXELS" IN_LIST ARGN)
+        list(APPEND LEVEL_OPTIONS --pixels)
+    endif()
+
+    get_filename_component(LEVEL_OUTPUT_DIR ${LEVEL_OUTPUT} DIRECTORY)
+    add_custom_command(OUTPUT ${LEVEL_OUTPUT}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${LEVEL_OUTPUT_DIR}
+        COMMAND ${Python3_EXECUTABLE} ${LEVEL_COMPILER} ${LEVEL_OPTIONS}
+                ${LEVEL_CSV} ${LEVEL_OUTPUT}
+        DEPENDS ${LEVEL_CSV} ${LEVEL_COMPILER}
+        COMMENT "Compiling level ${OUTPUT}"
+    )
+
+    string(MAKE_C_IDENTIFIER "${TARGET}_level_${OUTPUT}" LEVEL_TARGET)
+    add_custom_target(${LEVEL_TARGET} DEPENDS ${LEVEL_OUTPUT})
+    add_dependencies(${TARGET} ${LEVEL_TARGET})
+    sprite_producer(${LEVEL_TARGET} ${LEVEL_OUTPUT})
+
+    set_property(SOURCE ${SOURCE} APPEND PROPERTY OBJECT_DEPENDS ${LEVEL_OUTPUT})
+    target_include_directories(${TARGET} PRIVATE ${SPRITE_DIR})
+endfunction()
+
+# asset_pack(TARGET SOURCE OUTPUT [ALIGN BYTES] ASSETS TYPE:NAME=PATH [...])
+# Packs the assets into ${CMAKE_CURRENT_BINARY_DIR}/sprites/OUTPUT for
+# AssetPack::load(). A relative PATH is taken from the source directory when it
+# exists there, else from the sprites build directory, e.g. a blob written by
+# sprite_compile() or sprite_atlas().
+function(asset_pack TARGET SOURCE OUTPUT)
+    cmake_parse_arguments(PACK "" "ALIGN" "ASSETS" ${ARGN})
+    set(SPRITE_DIR ${CMAKE_CURRENT_BINARY_DIR}/sprites)
+    set(PACK_OUTPUT ${SPRITE_DIR}/${OUTPUT})
+    set(PACK_OPTIONS)
+    if(PACK_ALIGN)
+        list(APPEND PACK_OPTIONS --align ${PACK_ALIGN})
+    endif()
+
+    set(PACK_ENTRIES)
+    set(PACK_FILES)
+    foreach(ASSET ${PACK_ASSETS})
+        string(FIND ${ASSET} "=" PACK_SPLIT)
+        string(SUBSTRING ${ASSET} 0 ${PACK_SPLIT} PACK_KEY)
+        math(EXPR PACK_SPLIT "${PACK_SPLIT} + 1")
+        string(SUBSTRING ${ASSET} ${PACK_SPLIT} -1 PACK_FILE)
+        if(NOT IS_ABSOLUTE ${PACK_FILE})
+            if(EXISTS ${CMAKE_CURRENT_SOURCE_DIR}/${PACK_FILE})
+                set(PACK_FILE ${CMAKE_CURRENT_SOURCE_DIR}/${PACK_FILE})
+            else()
+                set(PACK_FILE ${SPRITE_DIR}/${PACK_FILE})
+            endif()
+        endif()
+        list(APPEND PACK_ENTRIES ${PACK_KEY}=${PACK_FILE})
+        list(APPEND PACK_FILES ${PACK_FILE})
+    endforeach()
+
+    get_filename_component(PACK_OUTPUT_DIR ${PACK_OUTPUT} DIRECTORY)
+    add_custom_command(OUTPUT ${PACK_OUTPUT}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${PACK_OUTPUT_DIR}
+        COMMAND ${Python3_EXECUTABLE} ${ASSET_PACKER} ${PACK_OPTIONS}
+                ${PACK_OUTPUT} ${PACK_ENTRIES}
+        DEPENDS ${PACK_FILES} ${ASSET_PACKER}
+        COMMENT "Packing assets ${OUTPUT}"
+    )
+
+    string(MAKE_C_IDENTIFIER "${TARGET}_pack_${OUTPUT}" PACK_TARGET)
+    add_custom_target(${PACK_TARGET} DEPENDS ${PACK_OUTPUT})
+    add_dependencies(${TARGET} ${PACK_TARGET})
+    foreach(FILE ${PACK_FILES})
+        get_property(PACK_PRODUCER GLOBAL PROPERTY SPRITE_PRODUCER_${FILE})
+        if(PACK_PRODUCER)
+            add_dependencies(${PACK_TARGET} ${PACK_PRODUCER})
+        endif()
+    endforeach()
+
+    set_property(SOURCE ${SOURCE} APPEND PROPERTY OBJECT_DEPENDS ${PACK_OUTPUT})
+    target_include_directories(${TARGET} PRIVATE ${SPRITE_DIR})
+endfunction()
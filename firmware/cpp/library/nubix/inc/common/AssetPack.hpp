@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * @file AssetPack.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief indexed pack of assets mapped from flash
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#define ASSET_PACK_MAGIC 0x4b41504e // "NPAK" read little endian
+
+/**
+ * @brief Kind of an asset, checked by AssetPack::find() so a name can not be used with
+ * the wrong loader
+ */
+enum class AssetType : uint8_t
+{
+    Raw,       // any data
+    Sprite,    // SpriteBlob for Sprite::load()
+    Animation, // AnimationBlob for AnimatedSprite::load()
+    Video,     // VideoBlob for Video::load()
+    Font,      // FontBlob for Font::load()
+    Level,     // level data of the game
+};
+
+/**
+ * @brief Header of an asset pack built by utils/asset_packer.py, followed by the index
+ * of count AssetEntry sorted by name and the data of the assets
+ */
+struct AssetPackBlob
+{
+    uint32_t magic; // ASSET_PACK_MAGIC
+    uint16_t count; // entries of the index
+    uint16_t align; // [bytes] alignment of all data, at least 4
+    uint32_t size;  // whole pack including this header [bytes]
+};
+
+/**
+ * @brief Entry of the index; assets with equal content share their data
+ */
+struct AssetEntry
+{
+    uint32_t name; // AssetPack::hash() of the asset name
+    uint8_t type;  // AssetType
+    uint8_t reserved[3];
+    uint32_t offset; // of the data from the start of the pack [bytes]
+    uint32_t size;   // [bytes]
+};
+
+/**
+ * @brief Read only view of an asset pack in flash; assets are used in place, e.g.
+ * Sprite::load() on the returned data, nothing is copied
+ */
+class AssetPack
+{
+public:
+    /**
+     * @brief Check a pack once, so find() needs no checks
+     *
+     * @param blob word aligned pack starting with AssetPackBlob, must stay valid
+     * @param size size of the blob in bytes
+     * @return new pack or NULL when the blob is invalid
+     */
+    static AssetPack *load(const uint32_t *blob, uint32_t size);
+
+    /**
+     * @brief Look up an asset with a binary search of the index
+     *
+     * @param name hash() of the asset name
+     * @param type expected type of the asset
+     * @param size set to the size of the asset in bytes, 0 when not found
+     * @return aligned data of the asset inside the pack or NULL when not found
+     */
+    const uint32_t *find(uint32_t name, AssetType type, uint32_t &size) const;
+
+    /**
+     * @brief Name hash of the asset packer: 32 bit FNV-1a of the characters,
+     * constexpr so names given as literal are hashed at compile time
+     */
+    static constexpr uint32_t hash(const char *name)
+    {
+        uint32_t h = 0x811c9dc5;
+
+        while (*name)
+            h = (h ^ (uint8_t)*name++) * 0x01000193;
+        return h;
+    }
+
+    unsigned int get_count() const { return c_count; };
+
+protected:
+    const uint8_t *c_base;
+    const AssetEntry *c_entries; // sorted by name
+    const unsigned int c_count;
+
+    AssetPack(const AssetPackBlob &header);
+};
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * @file AnimatedSprite.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief animated sprites of a keyframe and delta frames
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "Sprite.hpp"
+
+#define ANIMATION_BLOB_MAGIC 0x494e414e // "NANI" read little endian
+
+/**
+ * @brief Header of an animation compiled at build time by utils/animation_compiler.py
+ *
+ * The payload holds, each padded to whole words:
+ * - uint16_t duration of every frame [ms]
+ * - frame 0 as raw pixels in the sprite memory order (keyframe)
+ * - the deltas to frame 1, 2, ..., frames - 1 and back to frame 0
+ *
+ * A delta is a uint32_t number of runs, each run a uint32_t offset of its first pixel
+ * in the memory order, a uint32_t number of pixels and the pixels. Pixels are stored
+ * column by column, so a run is a changed part of a column or spans columns.
+ */
+struct AnimationBlob
+{
+    uint32_t magic;  // ANIMATION_BLOB_MAGIC
+    uint16_t width;  // [px]
+    uint16_t height; // [px]
+    uint8_t format;  // PixelFormat
+    uint8_t reserved;
+    uint16_t frames; // including the keyframe
+    uint32_t size;   // payload after the header [bytes]
+};
+
+/**
+ * @brief Sprite showing the current frame of an animation; the frames are applied to
+ * this one surface, only the deltas stay in flash
+ */
+class AnimatedSprite : public Sprite
+{
+public:
+    /**
+     * @brief Create an animation from a compiled blob, showing the keyframe
+     *
+     * @param blob word aligned blob starting with AnimationBlob, must stay valid
+     * @param size size of the blob in bytes
+     * @return new animation or NULL when the blob is invalid
+     */
+    static AnimatedSprite *load(const uint32_t *blob, uint32_t size);
+
+    /**
+     * @brief Advance the animation, looping after the last frame; applies the delta of
+     * every frame which was due
+     *
+     * @param elapsedMs time since the last update [ms]
+     * @return true when the pixels changed
+     */
+    bool update(uint32_t elapsedMs);
+
+    /**
+     * @brief Show the keyframe again
+     */
+    void rewind(void);
+
+    unsigned int get_frame() const { return m_frame; };
+    unsigned int get_frames() const { return c_frames; };
+
+protected:
+    const unsigned int c_frames;
+    const uint16_t *c_durations;   // [ms] per frame
+    const uint32_t *c_keyframe;    // raw pixels of frame 0
+    const uint32_t *c_deltas;      // delta to frame 1
+    const uint32_t c_loopMs;       // duration of all frames
+    const uint32_t *m_next;        // delta to the frame after m_frame
+    unsigned int m_frame;          // shown frame
+    uint32_t m_elapsedMs;          // time m_frame is shown already
+
+    AnimatedSprite(const AnimationBlob &header, const uint16_t *durations, const uint32_t *keyframe,
+                   const uint32_t *deltas, uint32_t loopMs);
+
+    void _apply(void);
+};
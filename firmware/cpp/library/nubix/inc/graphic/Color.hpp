@@ -291,6 +291,16 @@ static Color colorSetAlphaF(const Color color, float alpha)
     return (Color)out.raw;
 }
 
+/**
+ * @brief Convert a pixel given as bytes in the order red, green, blue, alpha (e.g. PNG)
+ *
+ * @param rgba pointer to the 4 bytes of the pixel, no alignment needed
+ */
+static inline Color colorFromRGBA(const uint8_t *rgba)
+{
+    return (Color)((uint32_t)rgba[3] << 24 | (uint32_t)rgba[0] << 16 | (uint32_t)rgba[1] << 8 | rgba[2]);
+}
+
 static inline Color colorSetAlphaI(const Color color, uint8_t alpha)
 {
     argb_t out;
@@ -38,6 +38,15 @@
 
 #include "Color.hpp"
 
+/**
+ * @brief Order of pixels in memory, as used by FrameBuffer and Display::update()
+ */
+enum class Layout
+{
+    ColumnMajor, // x * height + y; follows the panel refresh, tear free with vSync
+    RowMajor,    // y * width + x; rotated by the display controller
+};
+
 class Display {
 public:
     Display() {}
@@ -54,6 +63,39 @@ public:
      */
     virtual void update(uint32_t* frameBuffer, uint32_t pixelCount, bool vSync) = 0;
 
+    /**
+     * @brief Start to transfer an area in parts with writeArea(), e.g. while decoding it.
+     * Pixels are expected column by column (x * height + y) independent of setLayout().
+     *
+     * @param x left of the area
+     * @param y top of the area
+     * @param width width of the area
+     * @param height height of the area
+     * @param vSync wait for the frame refresh before the first pixels are sent
+     */
+    virtual void beginArea(unsigned int x, unsigned int y, unsigned int width, unsigned int height, bool vSync) = 0;
+
+    /**
+     * @brief Send the next pixels of the area; returns as soon as the transfer started, so
+     * the following pixels can be prepared meanwhile in another buffer
+     *
+     * @param pixels next pixels, must stay unchanged until the next writeArea() or endArea()
+     * @param pixelCount number of pixels, all of them together must fill the area
+     */
+    virtual void writeArea(const uint32_t* pixels, uint32_t pixelCount) = 0;
+
+    /**
+     * @brief Wait for the last pixels of the area
+     */
+    virtual void endArea(void) = 0;
+
+    /**
+     * @brief Select the memory layout expected by following calls of update()
+     *
+     * @param layout pixel order of the frame buffer
+     */
+    virtual void setLayout(Layout layout) = 0;
+
     /**
      * @brief Set the brightness of displays background LED
      *
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * @file FixedFrameBuffer.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief frame buffer with compile-time dimensions for full screen hot paths
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <algorithm>
+
+#include "FrameBuffer.hpp"
+
+/**
+ * @brief FrameBuffer with dimensions and layout known at compile time.
+ *
+ * Addressing, clipping and loop bounds of the hot primitives fold into constants. The
+ * methods hide the ones of FrameBuffer, so they are only used when called on this type;
+ * passing it as FrameBuffer falls back to the generic implementation. Sprites and other
+ * buffers sized at runtime keep using FrameBuffer.
+ */
+template <unsigned int W, unsigned int H, Layout L = Layout::ColumnMajor>
+class FixedFrameBuffer : public FrameBuffer
+{
+public:
+    static constexpr unsigned int kWidth = W;
+    static constexpr unsigned int kHeight = H;
+    static constexpr int kStepX = Layout::RowMajor == L ? 1 : H;
+    static constexpr int kStepY = Layout::RowMajor == L ? W : 1;
+
+    FixedFrameBuffer(Display &display)
+        : FrameBuffer(display, L)
+    {
+    }
+
+    constexpr unsigned int get_width() { return W; };
+    constexpr unsigned int get_height() { return H; };
+
+    using FrameBuffer::blit;
+
+    void point(unsigned int x, unsigned int y, Color color)
+    {
+        if (x >= W || y >= H)
+            return;
+        _setColor(color);
+        m_position = &m_buffer[x * kStepX + y * kStepY];
+        (this->*m_dotFunc)();
+    }
+
+    void line(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, Color color)
+    {
+        if (y0 == y1 && y0 < H) // horizontal, clipped to the screen
+        {
+            if (x0 > x1)
+                std::swap(x0, x1);
+            if (x0 < W)
+                _span(x0, y0, std::min(x1, W - 1) - x0 + 1, kStepX, color);
+        }
+        else if (x0 == x1 && x0 < W) // vertical, clipped to the screen
+        {
+            if (y0 > y1)
+                std::swap(y0, y1);
+            if (y0 < H)
+                _span(x0, y0, std::min(y1, H - 1) - y0 + 1, kStepY, color);
+        }
+        else
+            FrameBuffer::line(x0, y0, x1, y1, color);
+    }
+
+    void rectangle_filled(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, Color color)
+    {
+        if (x0 > x1)
+            std::swap(x0, x1);
+        if (y0 > y1)
+            std::swap(y0, y1);
+        if (x0 >= W || y0 >= H)
+            return;
+        x1 = std::min(x1, W - 1);
+        y1 = std::min(y1, H - 1);
+
+        if (Layout::RowMajor == L) // fill along the fast axis
+            for (unsigned int y = y0; y <= y1; y++)
+                _span(x0, y, x1 - x0 + 1, kStepX, color);
+        else
+            for (unsigned int x = x0; x <= x1; x++)
+                _span(x, y0, y1 - y0 + 1, kStepY, color);
+    }
+
+    // same output as FrameBuffer::circle_filled2, but one span per line of the fast axis
+    void circle_filled2(int xc, int yc, unsigned int radius, Color color)
+    {
+        const int r2 = (int)radius * (int)radius;
+        const int minA = Layout::RowMajor == L ? std::max(0, yc - (int)radius) : std::max(0, xc - (int)radius);
+        const int maxA = Layout::RowMajor == L ? std::min((int)H - 1, yc + (int)radius) : std::min((int)W - 1, xc + (int)radius);
+        const int cA = Layout::RowMajor == L ? yc : xc; // slow axis
+        const int cB = Layout::RowMajor == L ? xc : yc; // fast axis
+        const int limB = Layout::RowMajor == L ? W : H;
+        int half = 0;
+
+        _setColor(color);
+        for (int a = minA; a <= maxA; a++)
+        {
+            int rest = r2 - (a - cA) * (a - cA);
+
+            // largest half width with da² + half² <= r², moves by few steps only
+            while ((half + 1) * (half + 1) <= rest)
+                half++;
+            while (half > 0 && half * half > rest)
+                half--;
+
+            int b0 = std::max(0, cB - half);
+            int b1 = std::min(limB - 1, cB + half);
+            if (b0 > b1)
+                continue;
+
+            if (Layout::RowMajor == L)
+                m_position = &m_buffer[b0 * kStepX + a * kStepY];
+            else
+                m_position = &m_buffer[a * kStepX + b0 * kStepY];
+            for (int b = b0; b <= b1; b++)
+            {
+                (this->*m_dotFunc)();
+                m_position++;
+            }
+        }
+    }
+
+    void blit(int x0, int y0, unsigned int x1, unsigned int y1, unsigned int width, unsigned int height, FrameBuffer *frame)
+    {
+        if (frame == NULL)
+            return;
+
+        unsigned int w, h;
+
+        if (x0 < 0)
+        {
+            w = std::min(width, W);
+            x0 = 0;
+        }
+        else if (x0 < (int)W)
+            w = std::min(width, W - x0);
+        else
+            return;
+
+        if (y0 < 0)
+        {
+            h = std::min(height, H);
+            y0 = 0;
+        }
+        else if (y0 < (int)H)
+            h = std::min(height, H - y0);
+        else
+            return;
+
+        // inner loop walks along the fast axis of this buffer
+        const bool rows = Layout::RowMajor == L;
+        const int srcInner = rows ? frame->c_stepX : frame->c_stepY;
+        const int srcOuter = rows ? frame->c_stepY : frame->c_stepX;
+        unsigned int outer = rows ? h : w;
+        unsigned int inner = rows ? w : h;
+        Color *dst = &m_buffer[x0 * kStepX + y0 * kStepY];
+
+        frame->_setPos(x1, y1);
+        Color *src = frame->m_position;
+        while (outer--)
+        {
+            Color *d = dst;
+            Color *s = src;
+
+            for (unsigned int i = inner; i; i--)
+            {
+                if (0xff000000 == (*s & 0xff000000))
+                    *d = *s;
+                else
+                    *d = colorAlphaBlend(*s, *d);
+                d++;
+                s += srcInner;
+            }
+            dst += rows ? kStepY : kStepX;
+            src += srcOuter;
+        }
+    }
+
+    // clipping and addressing fold into constants, the pixels go through the kernel of the sprite format
+    void blit(int x0, int y0, unsigned int x1, unsigned int y1, unsigned int width, unsigned int height, const Sprite *sprite)
+    {
+        if (sprite == NULL)
+            return;
+
+        unsigned int w, h;
+
+        if (x0 < 0)
+        {
+            w = std::min(width, W);
+            x0 = 0;
+        }
+        else if (x0 < (int)W)
+            w = std::min(width, W - x0);
+        else
+            return;
+
+        if (y0 < 0)
+        {
+            h = std::min(height, H);
+            y0 = 0;
+        }
+        else if (y0 < (int)H)
+            h = std::min(height, H - y0);
+        else
+            return;
+
+        if (w && h)
+            sprite->blitTo(&m_buffer[x0 * kStepX + y0 * kStepY], Layout::RowMajor == L ? kStepY : kStepX, x1, y1, w, h, Layout::RowMajor == L);
+    }
+
+protected:
+    // count dots from x,y along step, all inside of the screen
+    void _span(unsigned int x, unsigned int y, unsigned int count, int step, Color color)
+    {
+        _setColor(color);
+        m_position = &m_buffer[x * kStepX + y * kStepY];
+        while (count--)
+        {
+            (this->*m_dotFunc)();
+            m_position += step;
+        }
+    }
+};
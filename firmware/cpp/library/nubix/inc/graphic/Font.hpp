@@ -48,6 +48,20 @@
 #include "Font_Azaret_small.h"
 #include "Font_Azaret_large.h"
 
+#define FONT_BLOB_MAGIC 0x544e464e // "NFNT" read little endian
+
+/**
+ * @brief Header of a font packed by utils/asset_packer.py, followed by the gray pixels
+ * of the image described above, row by row
+ */
+struct FontBlob
+{
+    uint32_t magic;  // FONT_BLOB_MAGIC
+    uint16_t width;  // [px] of all characters side by side
+    uint16_t height; // [px]
+    uint32_t size;   // payload after the header [bytes]
+};
+
 typedef struct {
   unsigned int 	 width;
   unsigned int 	 height;
@@ -64,6 +78,15 @@ class Font
     public:
         Font(unsigned int width, unsigned int height, const uint8_t* pData);
 
+        /**
+         * @brief Create a font from a packed blob, the pixels are used in place
+         *
+         * @param blob word aligned blob starting with FontBlob, must stay valid
+         * @param size size of the blob in bytes
+         * @return new font or NULL when the blob is invalid
+         */
+        static Font *load(const uint32_t *blob, uint32_t size);
+
         unsigned int getHeight() const;
         unsigned int getWidth() const;
         const uint8_t* getData(char c, unsigned int scanline) const;
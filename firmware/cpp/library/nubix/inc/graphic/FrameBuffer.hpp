@@ -43,6 +43,7 @@
 #include "PngImage.hpp"
 #include "Display.hpp"
 #include "Effect.hpp"
+#include "Sprite.hpp"
 
 class FrameBuffer;
 
@@ -50,9 +51,13 @@ typedef void (FrameBuffer::*DotFuncPtr)(void);
 
 class FrameBuffer
 {
+    template <unsigned int W, unsigned int H, Layout L>
+    friend class FixedFrameBuffer;
+
 public:
-    FrameBuffer(Display &display);
-    FrameBuffer(unsigned int width, unsigned int height);
+    FrameBuffer(Display &display, Layout layout = Layout::ColumnMajor);
+    FrameBuffer(unsigned int width, unsigned int height, Layout layout = Layout::ColumnMajor);
+    FrameBuffer(unsigned int width, unsigned int height, Color *buffer, Layout layout = Layout::ColumnMajor); // draw into memory owned by caller
     ~FrameBuffer(void);
 
     void show(bool vSync);
@@ -60,8 +65,21 @@ public:
 
     unsigned int get_width() { return c_width; };
     unsigned int get_height() { return c_height; };
+    Layout get_layout() { return c_layout; };
 
     void point(unsigned int x, unsigned int y, Color color);
+
+    /**
+     * @brief Draw a run of dots of a row given as RGBA bytes, blended like point()
+     *
+     * @param x0 X-coordinate of the first dot
+     * @param y0 Y-coordinate of the row
+     * @param step horizontal distance between the dots
+     * @param count number of dots
+     * @param rgba 4 bytes per dot in the order red, green, blue, alpha
+     */
+    void row_rgba(int x0, int y0, unsigned int step, unsigned int count, const uint8_t *rgba);
+
     void line(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, Color color);
     void line_soft(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, Color color);
     void line_soft2(int x1, int y1, int x2, int y2, int thickness, Color color);
@@ -92,6 +110,19 @@ public:
      */
     void blit(int x0, int y0, unsigned int x1, unsigned int y1, unsigned int width, unsigned int height, FrameBuffer *frame); //based on upper left corner
 
+    /**
+     * @brief Blit an area of a sprite with the specialized kernel of its pixel format
+     *
+     * @param x0 X-coordinate where we should draw on the FrameBuffer
+     * @param y0 Y-coordinate where we should draw on the FrameBuffer
+     * @param x1 X-coordinate from where we should start drawing the sprite into the FrameBuffer
+     * @param y1 Y-coordinate from where we should start drawing the sprite into the FrameBuffer
+     * @param width width of the area to draw from X1 and Y1
+     * @param height height of the area to draw from X1 and Y1
+     * @param sprite sprite to draw; nothing happens for NULL
+     */
+    void blit(int x0, int y0, unsigned int x1, unsigned int y1, unsigned int width, unsigned int height, const Sprite *sprite); //based on upper left corner
+
     /**
      * @brief Draw the given text on the framebuffer
      *
@@ -111,6 +142,9 @@ public:
 protected:
     const unsigned int c_width, c_height, c_buffSize;
     Display *c_pDisplay;
+    const Layout c_layout;
+    const int c_stepX, c_stepY; // distance in memory to the next pixel right and below
+    const bool c_ownBuffer;
     Color *m_buffer;
     Color *m_position;
     Color *m_boundary;
@@ -119,6 +153,7 @@ protected:
 
     void _setColor(Color color);
     void _setPos(unsigned int x, unsigned int y);
+    bool _clip(int &x0, int &y0, unsigned int &width, unsigned int &height);
     void _dot();       // set m_col to m_position when it is below m_boundary
     void _alpha_dot(); // color merge according to alpha channel of m_col
     void _char(unsigned int x0, unsigned int y0, const char c, const Font &font, Color foreG, Color backG);
@@ -39,6 +39,22 @@
 
 #define LED_PWM_FREQ 220 // 220Hz should be flicker free
 
+/**
+ * @brief Register values of GC9106 Frame_Rate_Set (0xa3); any value 0x00..0x7f
+ * is valid, the refresh rate follows roughly 2937.6Hz / (value + 32)
+ */
+enum class FrameRate : uint8_t
+{
+    Rate_91_8Hz = 0x00,
+    Rate_79_4Hz = 0x05,
+    Rate_69_9Hz = 0x0a,
+    Rate_59_9Hz = 0x11,
+    Rate_50_6Hz = 0x1a,
+    Rate_39_7Hz = 0x2a,
+    Rate_29_9Hz = 0x42,
+    Rate_18_5Hz = 0x7f,
+};
+
 class LT177ML35 : public Display
 {
 public:
@@ -56,19 +72,59 @@ public:
     }
 
     void update(uint32_t *frameBuffer, uint32_t pixelCount, bool vSync) override;
+    void beginArea(unsigned int x, unsigned int y, unsigned int width, unsigned int height, bool vSync) override;
+    void writeArea(const uint32_t *pixels, uint32_t pixelCount) override;
+    void endArea(void) override;
+    void setLayout(Layout layout) override;
     void setBrightness(unsigned int percent);
     void setStatusLED(Color color);
 
+    /**
+     * @brief Change the panels refresh rate at runtime; must not be called while
+     * an update() is in progress on the other core
+     *
+     * @param rate one of FrameRate or any raw Frame_Rate_Set value 0x00..0x7f
+     */
+    void setFrameRate(FrameRate rate);
+    FrameRate getFrameRate() const
+    {
+        return m_frameRate;
+    }
+
+    /**
+     * @brief Period of the panel refresh measured at the TE line
+     *
+     * @return averaged period in µs; nominal period of the current FrameRate until measured
+     */
+    uint32_t getFramePeriodUs() const;
+
+    /**
+     * @brief Rate of frames actually transferred by update()
+     *
+     * @return averaged present rate in mHz (59900 = 59.9 Hz), 0 before two frames were presented
+     */
+    uint32_t getPresentRate() const;
+
+    /**
+     * @brief Sleep until the next rising edge of TE, i.e. start of V-Blanking
+     */
+    void waitForVSync() const;
+
 private:
     const PIO c_pio;
     unsigned int m_sm_cmd_dat, m_sm_dat3_bgr, m_pio_offset, m_dmaTX, m_brightness;
+    FrameRate m_frameRate;
+    Layout m_layout, m_areaLayout; // m_areaLayout is restored by endArea()
+    uint32_t m_lastPresentUs, m_presentPeriodUs;
 
     LT177ML35();
     void init();
     void initPIO();
     void initPWM(unsigned int pin);
+    void initTE();
     void writeCmd(uint8_t cmd);
     void writeData(uint8_t cmd);
+    void setAddress(unsigned int column, unsigned int row, unsigned int columns, unsigned int rows);
 
     // no copy constructor or assignment operator = to avoid multiple instances
     LT177ML35(const LT177ML35&) = delete;
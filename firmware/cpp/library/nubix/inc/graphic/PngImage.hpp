@@ -38,12 +38,15 @@
 #include <stdint.h>
 
 #include "FrameBuffer.hpp"
+#include "Sprite.hpp"
 #include "pngle.h"
 
 class FrameBuffer;
 
 /**
  * @brief Class for interfacing pngimage with FrameBuffer.
+ * @note Decoding is reentrant, every core decodes with a decoder of its own (about 44 KB),
+ * allocated on first use and kept until releaseDecoders().
  */
 class PngImage
 {
@@ -74,6 +77,26 @@ public:
      */
     FrameBuffer *render(void);
 
+    /**
+     * Decode PNG into an existing Sprite, converted to its pixel format.
+     * @param[in] sprite Sprite to decode into, should have the size of the image.
+     * @return false on decode error.
+     */
+    bool render(Sprite &sprite);
+
+    /**
+     * Create a new Sprite with size and content of PNG image.
+     * @param[in] format Pixel format to convert the image to.
+     * @return New sprite with image, NULL on decode error.
+     */
+    Sprite *render(PixelFormat format);
+
+    /**
+     * Free the decoders which are not decoding right now, e.g. when SRAM is needed for
+     * something else; the next render call allocates a decoder again.
+     */
+    static void releaseDecoders(void);
+
     /**
      * Get image width.
      * @note This does not test if data is a PNG.
@@ -93,6 +116,10 @@ private:
     const uint32_t *c_pData;
     //! Image size [bytes].
     const uint32_t c_dataSize;
-    //! pngle handler.
-    pngle_t *m_pngHandle;
+
+    /**
+     * Decode with the decoder of the calling core into either buffer or sprite.
+     * @return true when all data was decoded.
+     */
+    bool _decode(FrameBuffer *buffer, Sprite *sprite, int x, int y);
 };
@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * @file Sprite.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief sprite surfaces with compact pixel formats
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "Color.hpp"
+#include "Display.hpp"
+#include "PixelFormat.hpp"
+
+#define SPRITE_BLOB_MAGIC 0x5250534e // "NSPR" read little endian
+
+#ifndef SPRITE_STREAM_COLUMNS
+#define SPRITE_STREAM_COLUMNS 4u // columns per band of stream(), two bands of 2 KB each on the 160x128 display
+#endif
+
+/**
+ * @brief Header of a sprite compiled at build time by utils/sprite_compiler.py,
+ * followed by the pixels in the sprite memory order
+ */
+struct SpriteBlob
+{
+    uint32_t magic;   // SPRITE_BLOB_MAGIC
+    uint16_t width;   // [px]
+    uint16_t height;  // [px]
+    uint8_t format;   // PixelFormat
+    uint8_t encoding; // 0: raw pixels, 1: run length encoded, 2: QOI style, see SpriteDecoder
+    uint16_t reserved;
+    uint32_t size; // payload after the header [bytes]
+};
+
+/**
+ * @brief Area of a sprite inside an atlas, tables are generated by utils/atlas_packer.py
+ */
+struct SpriteRect
+{
+    uint16_t x, y;
+    uint16_t width, height;
+};
+
+/**
+ * @brief Read only image for FrameBuffer::blit(), stored column by column like the FrameBuffer
+ * default layout. Pixels are converted to the chosen format once, when they are set.
+ */
+class Sprite
+{
+public:
+    Sprite(unsigned int width, unsigned int height, PixelFormat format);
+    Sprite(unsigned int width, unsigned int height, PixelFormat format, const void *pixels); // read only pixels owned by caller, e.g. in flash
+    Sprite(const Sprite &atlas, const SpriteRect &rect); // read only view of an area inside atlas, must not outlive atlas
+    ~Sprite(void);
+
+    /**
+     * @brief Create a sprite from a compiled blob; raw pixels are used in place (no copy),
+     * encoded pixels are unpacked into SRAM
+     *
+     * @param blob word aligned blob starting with SpriteBlob
+     * @param size size of the blob in bytes
+     * @return new sprite or NULL when the blob is invalid
+     */
+    static Sprite *load(const uint32_t *blob, uint32_t size);
+
+    /**
+     * @brief Show a compiled blob centered on the display without a frame buffer; the
+     * screen is decoded band by band of SPRITE_STREAM_COLUMNS columns, each band is
+     * transferred while the next one is decoded
+     *
+     * @param blob word aligned blob starting with SpriteBlob, raw or QOI encoded
+     * @param size size of the blob in bytes
+     * @param display display to show the blob on, the whole screen is replaced
+     * @param background color around the sprite and behind transparent pixels
+     * @return false when the blob is invalid, run length encoded or larger than the display
+     */
+    static bool stream(const uint32_t *blob, uint32_t size, Display &display, Color background);
+
+    unsigned int get_width() const { return c_width; };
+    unsigned int get_height() const { return c_height; };
+    PixelFormat get_format() const { return c_format; };
+
+    /**
+     * @brief Memory used by the pixels
+     *
+     * @return size in bytes
+     */
+    unsigned int get_size() const { return c_width * c_height * bytesPerPixel(c_format); };
+
+    /**
+     * @brief Set color of A8 masks; alpha of tint scales the mask
+     *
+     * @param tint color used for all dots of the mask
+     */
+    void setTint(Color tint) { m_tint = tint; };
+    Color getTint() const { return m_tint; };
+
+    /**
+     * @brief Replace a pixel, color is converted to the format of the sprite
+     * @note Ignored for sprites with read only pixels
+     *
+     * @param x horizontal position, ignored when out of bounds
+     * @param y vertical position, ignored when out of bounds
+     * @param color straight (not premultiplied) ARGB color
+     */
+    void point(unsigned int x, unsigned int y, Color color);
+
+    /**
+     * @brief Replace a run of pixels of a row, converted to the format of the sprite
+     *
+     * @param x first horizontal position, pixels out of bounds are ignored
+     * @param y vertical position
+     * @param step horizontal distance between the pixels
+     * @param count number of pixels
+     * @param rgba 4 bytes per pixel in the order red, green, blue, alpha (straight)
+     */
+    void setRow(unsigned int x, unsigned int y, unsigned int step, unsigned int count, const uint8_t *rgba);
+
+    /**
+     * @brief Pixel memory of 32 bit formats, e.g. to draw into it with a FrameBuffer using
+     * the same memory; drawing onto transparent black results in premultiplied colors
+     *
+     * @return column-major pixels or NULL for formats other than ARGB8888 and ARGB8888Pre
+     * and for read only pixels
+     */
+    Color *getPixels()
+    {
+        return 4 == bytesPerPixel(c_format) && c_ownData ? (Color *)m_data : NULL;
+    };
+
+    /**
+     * @brief Copy an area onto frame buffer memory with the kernel of the pixel format
+     *
+     * @param dst first destination pixel, area must be inside of the frame buffer
+     * @param dstOuter distance to next destination line; dots of a line are consecutive
+     * @param x1 left of source area
+     * @param y1 top of source area
+     * @param width width of area
+     * @param height height of area
+     * @param rows true when lines are rows (row-major destination), false for columns
+     */
+    void blitTo(Color *dst, int dstOuter, unsigned int x1, unsigned int y1, unsigned int width, unsigned int height, bool rows) const;
+
+    static constexpr unsigned int bytesPerPixel(PixelFormat format)
+    {
+        return PixelFormat::A8 == format ? 1 : (PixelFormat::ARGB4444 == format || PixelFormat::RGB565 == format ? 2 : 4);
+    }
+
+protected:
+    const unsigned int c_width, c_height;
+    const PixelFormat c_format;
+    const bool c_ownData;                 // false when pixels are read only
+    const unsigned int c_pitch, c_offset; // pixels from one column to the next, first pixel
+    uint32_t *m_data;                     // word aligned for all formats
+    Color m_tint;
+
+    bool _unpack(const uint8_t *src, uint32_t size);
+
+    // no copy constructor or assignment operator = to avoid double free
+    Sprite(const Sprite &) = delete;
+    Sprite &operator=(const Sprite &) = delete;
+};
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * @file SpriteDecoder.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief streaming decoder of QOI style sprite blobs
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "PixelFormat.hpp"
+
+/**
+ * @brief Decoder of sprite blob encoding 2, written by utils/sprite_compiler.py --qoi
+ *
+ * The ops are the ones of QOI (index, diff, luma, run, rgb, rgba) on four channels
+ * a, r, g, b. Channels hold the bits of the pixel format (e.g. 0..15 for ARGB4444),
+ * A8 uses r = g = b = alpha. Pixels are written column by column in the pixel format,
+ * the memory order of Sprite and FrameBuffer. Decoding can stop after any pixel and
+ * continue with the next call, so a sprite can be decoded in parts.
+ */
+class SpriteDecoder
+{
+public:
+    SpriteDecoder(PixelFormat format);
+
+    /**
+     * @brief Start a new image
+     */
+    void reset(void);
+
+    /**
+     * @brief Decode the next pixels
+     *
+     * @param src next encoded byte, advanced past the consumed ops
+     * @param srcEnd end of the encoded bytes; an op cut off at the end is left in src
+     * @param dst destination pixels in the pixel format
+     * @param count number of pixels to decode
+     * @return number of decoded pixels, less than count when the encoded bytes end
+     */
+    unsigned int decode(const uint8_t *&src, const uint8_t *srcEnd, void *dst, unsigned int count);
+
+protected:
+    const PixelFormat c_format;
+    uint32_t m_prev;      // a << 24 | r << 16 | g << 8 | b
+    unsigned int m_run;   // pixels of the current run still to write
+    uint32_t m_index[64]; // recently seen pixels by hash
+
+    template <typename T, typename Pack>
+    unsigned int _decode(const uint8_t *&src, const uint8_t *srcEnd, T *dst, unsigned int count, Pack pack);
+};
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * @file Video.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief full screen videos streamed from flash
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "Color.hpp"
+#include "Display.hpp"
+#include "PixelFormat.hpp"
+#include "SpriteDecoder.hpp"
+
+#define VIDEO_BLOB_MAGIC 0x4449564e // "NVID" read little endian
+
+#ifndef VIDEO_BAND_PIXELS
+#define VIDEO_BAND_PIXELS 256u // pixels per band of Video::showFrame(), two bands of 1 KB each
+#endif
+
+/**
+ * @brief Header of a video compiled at build time by utils/video_compiler.py
+ *
+ * The payload holds the frames, each starting at a word: a VideoFrame, its windows
+ * and the pixels of all windows encoded with QOI ops (see SpriteDecoder), padded to
+ * whole words. Frame 0 covers the whole video, later frames only the blocks which
+ * changed since the frame before, so the display memory keeps all other pixels.
+ */
+struct VideoBlob
+{
+    uint32_t magic;    // VIDEO_BLOB_MAGIC
+    uint16_t width;    // [px]
+    uint16_t height;   // [px]
+    uint8_t format;    // PixelFormat, RGB565 or ARGB8888 without transparency
+    uint8_t block;     // [px] edge of the square blocks the windows are made of
+    uint16_t frames;   // including frame 0
+    uint32_t periodUs; // [us] time between two frames
+    uint32_t size;     // payload after the header [bytes]
+};
+
+/**
+ * @brief Header of a frame inside VideoBlob, followed by its windows and pixels
+ */
+struct VideoFrame
+{
+    uint16_t windows; // number of VideoWindow
+    uint16_t reserved;
+    uint32_t size; // encoded pixels of all windows [bytes]
+};
+
+/**
+ * @brief Changed area of a frame in blocks; pixels are column by column and the
+ * blocks at the right and bottom border are cut at the video size
+ */
+struct VideoWindow
+{
+    uint8_t x, y;
+    uint8_t width, height;
+};
+
+/**
+ * @brief Player of a compiled video, which is streamed from flash into the display
+ * without frame buffer. The pixels of a window are decoded band by band of
+ * VIDEO_BAND_PIXELS, each band is transferred while the next one is decoded.
+ */
+class Video
+{
+public:
+    /**
+     * @brief Create a player of a compiled blob, starting at frame 0
+     *
+     * @param blob word aligned blob starting with VideoBlob, must stay valid
+     * @param size size of the blob in bytes
+     * @return new player or NULL when the blob is invalid
+     */
+    static Video *load(const uint32_t *blob, uint32_t size);
+
+    /**
+     * @brief Show the next frame centered on the display, when it is due, starting
+     * with the frame refresh; loops to frame 0 after the last frame
+     * @note The frame buffer must not be shown meanwhile, the area around a smaller
+     * video is left unchanged
+     *
+     * @param display display to show the video on
+     * @return false when the video is larger than the display or its pixels are invalid
+     */
+    bool showFrame(Display &display);
+
+    /**
+     * @brief Show all frames from the current one to the last one
+     *
+     * @param display display to show the video on
+     * @return false when a frame could not be shown, see showFrame()
+     */
+    bool play(Display &display);
+
+    /**
+     * @brief Continue with frame 0, due immediately
+     */
+    void rewind(void);
+
+    unsigned int get_width() const { return c_width; };
+    unsigned int get_height() const { return c_height; };
+    unsigned int get_frame() const { return m_frame; };
+    unsigned int get_frames() const { return c_frames; };
+    uint32_t get_period_us() const { return c_periodUs; };
+
+protected:
+    const unsigned int c_width, c_height;
+    const PixelFormat c_format;
+    const unsigned int c_block;
+    const unsigned int c_frames;
+    const uint32_t c_periodUs;
+    const uint32_t *c_first;  // frame 0
+    const uint32_t *m_next;   // frame shown by the next showFrame()
+    unsigned int m_frame;     // index of m_next
+    uint32_t m_dueUs;         // time to show m_next
+    SpriteDecoder m_decoder;
+    Color m_bands[2 * VIDEO_BAND_PIXELS];
+    uint32_t m_pixels[VIDEO_BAND_PIXELS]; // decoded band in the video format
+
+    Video(const VideoBlob &header, const uint32_t *first);
+
+    // no copy constructor or assignment operator = to keep the object in one place
+    Video(const Video &) = delete;
+    Video &operator=(const Video &) = delete;
+};
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * @file AssetPack.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief indexed pack of assets mapped from flash
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include <cstddef>
+
+#include "common/AssetPack.hpp"
+
+AssetPack::AssetPack(const AssetPackBlob &header)
+    : c_base((const uint8_t *)&header),
+      c_entries((const AssetEntry *)(&header + 1)),
+      c_count(header.count)
+{}
+
+AssetPack *AssetPack::load(const uint32_t *blob, uint32_t size)
+{
+    const AssetPackBlob *header = (const AssetPackBlob *)blob;
+
+    if (NULL == blob || size < sizeof(AssetPackBlob) || ASSET_PACK_MAGIC != header->magic ||
+        header->align < 4 || 0 != (header->align & (header->align - 1)) || header->size > size ||
+        header->size < sizeof(AssetPackBlob) ||
+        (header->size - sizeof(AssetPackBlob)) / sizeof(AssetEntry) < header->count)
+        return NULL;
+
+    const AssetEntry *entries = (const AssetEntry *)(header + 1);
+    for (unsigned int i = 0; i < header->count; i++)
+    {
+        // strictly ascending names, so the binary search finds the only one
+        if ((i > 0 && entries[i].name <= entries[i - 1].name) || 0 != entries[i].offset % header->align ||
+            entries[i].offset > header->size || entries[i].size > header->size - entries[i].offset)
+            return NULL;
+    }
+
+    return new AssetPack(*header);
+}
+
+const uint32_t *AssetPack::find(uint32_t name, AssetType type, uint32_t &size) const
+{
+    unsigned int first = 0;
+    unsigned int last = c_count;
+
+    size = 0;
+    while (first < last)
+    {
+        unsigned int middle = (first + last) / 2;
+
+        if (c_entries[middle].name < name)
+        {
+            first = middle + 1;
+        }
+        else if (c_entries[middle].name > name)
+        {
+            last = middle;
+        }
+        else
+        {
+            if ((uint8_t)type != c_entries[middle].type)
+                return NULL;
+            size = c_entries[middle].size;
+            return (const uint32_t *)(c_base + c_entries[middle].offset);
+        }
+    }
+    return NULL;
+}
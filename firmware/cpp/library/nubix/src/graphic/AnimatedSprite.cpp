@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * @file AnimatedSprite.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief animated sprites of a keyframe and delta frames
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include <cstring>
+
+#include "graphic/AnimatedSprite.hpp"
+
+// pixels of a run in whole words
+static inline uint32_t _words(uint32_t count, unsigned int pixelBytes)
+{
+    return (count * pixelBytes + 3) / 4;
+}
+
+AnimatedSprite::AnimatedSprite(const AnimationBlob &header, const uint16_t *durations, const uint32_t *keyframe,
+                               const uint32_t *deltas, uint32_t loopMs)
+    : Sprite(header.width, header.height, (PixelFormat)header.format),
+      c_frames(header.frames),
+      c_durations(durations),
+      c_keyframe(keyframe),
+      c_deltas(deltas),
+      c_loopMs(loopMs)
+{
+    rewind();
+}
+
+// all runs are checked once here, so _apply() copies without checks
+AnimatedSprite *AnimatedSprite::load(const uint32_t *blob, uint32_t size)
+{
+    const AnimationBlob *header = (const AnimationBlob *)blob;
+
+    if (NULL == blob || size < sizeof(AnimationBlob) || ANIMATION_BLOB_MAGIC != header->magic ||
+        header->format > (uint8_t)PixelFormat::A8 || 0 == header->frames ||
+        size - sizeof(AnimationBlob) < header->size)
+        return NULL;
+
+    const unsigned int pixelBytes = bytesPerPixel((PixelFormat)header->format);
+    const uint32_t pixels = header->width * header->height;
+    const uint32_t *payload = (const uint32_t *)(header + 1);
+    const uint32_t *end = payload + header->size / 4;
+    const uint16_t *durations = (const uint16_t *)payload;
+    const uint32_t *keyframe = payload + (header->frames + 1) / 2;
+    const uint32_t *deltas = keyframe + _words(pixels, pixelBytes);
+    uint32_t loopMs = 0;
+
+    if (deltas > end)
+        return NULL;
+    for (unsigned int i = 0; i < header->frames; i++)
+    {
+        if (0 == durations[i])
+            return NULL;
+        loopMs += durations[i];
+    }
+
+    // a single frame has no deltas, otherwise one per frame including the one back to frame 0
+    const uint32_t *p = deltas;
+    for (unsigned int i = 0; header->frames > 1 && i < header->frames; i++)
+    {
+        if (p >= end)
+            return NULL;
+        for (uint32_t runs = *p++; runs--;)
+        {
+            if (end - p < 2 || p[0] > pixels || p[1] > pixels - p[0])
+                return NULL;
+            uint32_t words = _words(p[1], pixelBytes);
+            p += 2;
+            if ((uint32_t)(end - p) < words)
+                return NULL;
+            p += words;
+        }
+    }
+
+    return new AnimatedSprite(*header, durations, keyframe, deltas, loopMs);
+}
+
+bool AnimatedSprite::update(uint32_t elapsedMs)
+{
+    bool changed = false;
+
+    if (c_frames < 2)
+        return false;
+
+    // whole loops end on the same frame
+    m_elapsedMs = (m_elapsedMs + elapsedMs % c_loopMs) % c_loopMs;
+    while (m_elapsedMs >= c_durations[m_frame])
+    {
+        m_elapsedMs -= c_durations[m_frame];
+        _apply();
+        changed = true;
+    }
+    return changed;
+}
+
+void AnimatedSprite::rewind(void)
+{
+    memcpy(m_data, c_keyframe, get_size());
+    m_next = c_deltas;
+    m_frame = 0;
+    m_elapsedMs = 0;
+}
+
+void AnimatedSprite::_apply(void)
+{
+    const unsigned int pixelBytes = bytesPerPixel(c_format);
+    const uint32_t *p = m_next;
+
+    for (uint32_t runs = *p++; runs--;)
+    {
+        uint32_t offset = *p++;
+        uint32_t count = *p++;
+
+        memcpy((uint8_t *)m_data + offset * pixelBytes, p, count * pixelBytes);
+        p += _words(count, pixelBytes);
+    }
+
+    m_frame = (m_frame + 1) % c_frames;
+    m_next = 0 == m_frame ? c_deltas : p;
+}
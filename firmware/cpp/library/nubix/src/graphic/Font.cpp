@@ -43,6 +43,18 @@ Font::Font(unsigned int width, unsigned int height, const uint8_t *pData)
       c_pData(pData)
 {}
 
+Font *Font::load(const uint32_t *blob, uint32_t size)
+{
+    const FontBlob *header = (const FontBlob *)blob;
+
+    if (NULL == blob || size < sizeof(FontBlob) || FONT_BLOB_MAGIC != header->magic ||
+        size - sizeof(FontBlob) < header->size || header->width < 95 ||
+        (uint32_t)header->width * header->height > header->size)
+        return NULL;
+
+    return new Font(header->width, header->height, (const uint8_t *)(header + 1));
+}
+
 unsigned int Font::getHeight() const
 {
     return c_height;
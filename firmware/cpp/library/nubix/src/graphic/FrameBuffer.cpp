@@ -58,37 +58,64 @@ _prepareCriticalSection()
     dma_channel_set_config(_dmaClear, &conf, false);
 }
 
-FrameBuffer::FrameBuffer(Display &display)
+FrameBuffer::FrameBuffer(Display &display, Layout layout)
     : c_pDisplay(&display),
       c_width(display.getWidth()),
       c_height(display.getHeight()),
-      c_buffSize(c_width * c_height)
+      c_buffSize(c_width * c_height),
+      c_layout(layout),
+      c_stepX(Layout::RowMajor == layout ? 1 : c_height),
+      c_stepY(Layout::RowMajor == layout ? c_width : 1),
+      c_ownBuffer(true)
 {
     m_buffer = new Color[c_buffSize];
     m_boundary = &m_buffer[c_buffSize + 1];
     _setColor(Color::White);
 }
 
-FrameBuffer::FrameBuffer(unsigned int width, unsigned int height)
+FrameBuffer::FrameBuffer(unsigned int width, unsigned int height, Layout layout)
     : c_pDisplay(NULL),
       c_width(width),
       c_height(height),
-      c_buffSize(c_width * c_height)
+      c_buffSize(c_width * c_height),
+      c_layout(layout),
+      c_stepX(Layout::RowMajor == layout ? 1 : c_height),
+      c_stepY(Layout::RowMajor == layout ? c_width : 1),
+      c_ownBuffer(true)
 {
     m_buffer = new Color[c_buffSize];
     m_boundary = &m_buffer[c_buffSize + 1];
     _setColor(Color::White);
 }
 
+FrameBuffer::FrameBuffer(unsigned int width, unsigned int height, Color *buffer, Layout layout)
+    : c_pDisplay(NULL),
+      c_width(width),
+      c_height(height),
+      c_buffSize(c_width * c_height),
+      c_layout(layout),
+      c_stepX(Layout::RowMajor == layout ? 1 : c_height),
+      c_stepY(Layout::RowMajor == layout ? c_width : 1),
+      c_ownBuffer(false)
+{
+    m_buffer = buffer;
+    m_boundary = &m_buffer[c_buffSize + 1];
+    _setColor(Color::White);
+}
+
 FrameBuffer::~FrameBuffer()
 {
-    delete m_buffer;
+    if (c_ownBuffer)
+        delete[] m_buffer;
 }
 
 void FrameBuffer::show(bool vSync)
 {
     if (c_pDisplay)
+    {
+        c_pDisplay->setLayout(c_layout);
         c_pDisplay->update((uint32_t *)&m_buffer[0], c_buffSize, vSync);
+    }
 }
 
 void FrameBuffer::clear(Color color)
@@ -109,7 +136,7 @@ void FrameBuffer::_setPos(unsigned int x, unsigned int y)
     if (x >= c_width || y >= c_height)
         m_position = &dummy_position;
     else
-        m_position = x * c_height + y + &m_buffer[0]; // Display is rotated
+        m_position = x * c_stepX + y * c_stepY + &m_buffer[0];
 }
 
 // set m_curCol to m_position when it is below m_boundary (performed in 80ns)
@@ -140,18 +167,54 @@ void FrameBuffer::point(unsigned int x, unsigned int y, Color color)
     (this->*m_dotFunc)();
 }
 
+void FrameBuffer::row_rgba(int x0, int y0, unsigned int step, unsigned int count, const uint8_t *rgba)
+{
+    if (y0 < 0 || y0 >= (int)c_height || 0 == step)
+        return;
+
+    // skip dots left of the frame, then stop at the right edge
+    if (x0 < 0)
+    {
+        unsigned int skip = (-x0 + step - 1) / step;
+
+        if (skip >= count)
+            return;
+        x0 += skip * step;
+        rgba += skip * 4;
+        count -= skip;
+    }
+    if (x0 >= (int)c_width)
+        return;
+    count = std::min(count, (c_width - x0 + step - 1) / step);
+
+    Color *pos = &m_buffer[x0 * c_stepX + y0 * c_stepY];
+    int inc = step * c_stepX;
+
+    while (count--)
+    {
+        uint8_t a = rgba[3];
+
+        if (0xff == a)
+            *pos = colorFromRGBA(rgba);
+        else if (a)
+            *pos = colorAlphaBlend(colorFromRGBA(rgba), *pos);
+        pos += inc;
+        rgba += 4;
+    }
+}
+
 // performed in less than 45µs (max)
 void FrameBuffer::line(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, Color color)
 {
-    int distX = std::abs((int)x1 - (int)x0), stepX = x0 < x1 ? c_height : c_height * -1;
-    int distY = std::abs((int)y1 - (int)y0), stepY = y0 < y1 ? 1 : -1;
+    int distX = std::abs((int)x1 - (int)x0), stepX = x0 < x1 ? c_stepX : -c_stepX;
+    int distY = std::abs((int)y1 - (int)y0), stepY = y0 < y1 ? c_stepY : -c_stepY;
 
     if (0 == distY) // simple horizontal line
     {
         point(stepX > 0 ? x0 : x1, y0, color); // left start
         while (distX--)
         {
-            m_position += c_height;
+            m_position += c_stepX;
             (this->*m_dotFunc)();
         }
     }
@@ -160,14 +223,14 @@ void FrameBuffer::line(unsigned int x0, unsigned int y0, unsigned int x1, unsign
         point(x0, stepY > 0 ? y0 : y1, color); // top start
         while (distY--)
         {
-            m_position++;
+            m_position += c_stepY;
             (this->*m_dotFunc)();
         }
     }
     else // Bresenham algorithm
     {
         int err = (distX > distY ? distX : -distY) / 2, e2;
-        Color *destPos = x1 * c_height + y1 + &m_buffer[0]; // Display is rotated
+        Color *destPos = x1 * c_stepX + y1 * c_stepY + &m_buffer[0];
 
         point(x0, y0, color);
         while (m_position != destPos)
@@ -374,11 +437,22 @@ void FrameBuffer::round_rectangle(unsigned int x0, unsigned int y0, unsigned int
 // performed in less than 3.26ms (max)
 void FrameBuffer::rectangle_filled(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, Color color)
 {
-    if (x0 > x1)
-        std::swap(x0, x1);
+    if (Layout::RowMajor == c_layout) // fill along the fast axis
+    {
+        if (y0 > y1)
+            std::swap(y0, y1);
 
-    for (unsigned int x = x0; x <= x1; x++)
-        line(x, y0, x, y1, color);
+        for (unsigned int y = y0; y <= y1; y++)
+            line(x0, y, x1, y, color);
+    }
+    else
+    {
+        if (x0 > x1)
+            std::swap(x0, x1);
+
+        for (unsigned int x = x0; x <= x1; x++)
+            line(x, y0, x, y1, color);
+    }
 }
 
 void FrameBuffer::round_rectangle_filled(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, unsigned int radius, Color color)
@@ -487,12 +561,45 @@ void FrameBuffer::circle_filled(unsigned int xc, unsigned int yc, unsigned int r
     int x = 0;
     int y = radius;
 
+    if (Layout::RowMajor == c_layout) // draw horizontal spans along the fast axis
+    {
+        auto span = [&](int row, int xl, int xr)
+        {
+            if (row < 0 || row >= (int)c_height)
+                return;
+            xl = std::max(xl, 0);
+            xr = std::min(xr, (int)c_width - 1);
+            if (xl <= xr)
+                line(xl, row, xr, row, color);
+        };
+
+        span(yc, (int)xc - (int)radius, (int)xc + (int)radius);
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x + 1;
+
+            span((int)yc + y, (int)xc - x, (int)xc + x);
+            span((int)yc - y, (int)xc - x, (int)xc + x);
+            span((int)yc + x, (int)xc - y, (int)xc + y);
+            span((int)yc - x, (int)xc - y, (int)xc + y);
+        }
+        return;
+    }
+
     // Check screen boundaries before drawing each line segment
-    if (yc + radius < DISP_HEIGHT)
+    if (yc + radius < c_height)
         line(xc, yc + radius, xc, yc - radius, color);
 
     // Check screen boundaries before drawing each line segment
-    if (xc + radius < DISP_WIDTH)
+    if (xc + radius < c_width)
         line(xc + radius, yc, xc - radius, yc, color);
 
     while (x < y)
@@ -508,13 +615,13 @@ void FrameBuffer::circle_filled(unsigned int xc, unsigned int yc, unsigned int r
         f += ddF_x + 1;
 
         // Check screen boundaries before drawing each line segment
-        if (((int) xc) + x >= 0 && xc + x < DISP_WIDTH && ((int) yc) + y >= 0 && yc + y < DISP_HEIGHT)
+        if (((int) xc) + x >= 0 && xc + x < c_width && ((int) yc) + y >= 0 && yc + y < c_height)
             line(xc + x, yc + y, xc + x, yc - y, color);
-        if (((int) xc) - x >= 0 && xc - x < DISP_WIDTH && ((int) yc) + y >= 0 && yc + y < DISP_HEIGHT)
+        if (((int) xc) - x >= 0 && xc - x < c_width && ((int) yc) + y >= 0 && yc + y < c_height)
             line(xc - x, yc + y, xc - x, yc - y, color);
-        if (((int) xc) + y >= 0 && xc + y < DISP_WIDTH && ((int) yc) + x >= 0 && yc + x < DISP_HEIGHT)
+        if (((int) xc) + y >= 0 && xc + y < c_width && ((int) yc) + x >= 0 && yc + x < c_height)
             line(xc + y, yc + x, xc + y, yc - x, color);
-        if (((int) xc) - y >= 0 && xc - y < DISP_WIDTH && ((int) yc) + x >= 0 && yc + x < DISP_HEIGHT)
+        if (((int) xc) - y >= 0 && xc - y < c_width && ((int) yc) + x >= 0 && yc + x < c_height)
             line(xc - y, yc + x, xc - y, yc - x, color);
     }
 }
@@ -525,9 +632,9 @@ void FrameBuffer::circle_filled2(int xc, int yc, unsigned int radius, Color colo
 
     // Calculate the bounding box of the circle
     int xMin = std::max(0, static_cast<int>(xc) - static_cast<int>(radius));
-    int xMax = std::min(static_cast<int>(DISP_WIDTH) - 1, static_cast<int>(xc) + static_cast<int>(radius));
+    int xMax = std::min(static_cast<int>(c_width) - 1, static_cast<int>(xc) + static_cast<int>(radius));
     int yMin = std::max(0, static_cast<int>(yc) - static_cast<int>(radius));
-    int yMax = std::min(static_cast<int>(DISP_HEIGHT) - 1, static_cast<int>(yc) + static_cast<int>(radius));
+    int yMax = std::min(static_cast<int>(c_height) - 1, static_cast<int>(yc) + static_cast<int>(radius));
 
     // Iterate through each point within the bounding box
     for (x = xMin; x <= xMax; x++)
@@ -535,7 +642,7 @@ void FrameBuffer::circle_filled2(int xc, int yc, unsigned int radius, Color colo
         for (y = yMin; y <= yMax; y++)
         {
             // Check if the point is within the frame buffer bounds
-            if (x >= 0 && x < DISP_WIDTH && y >= 0 && y < DISP_HEIGHT)
+            if (x >= 0 && x < (int) c_width && y >= 0 && y < (int) c_height)
             {
                 // Check if the point is within the circle's radius
                 int dx = x - static_cast<int>(xc);
@@ -555,9 +662,9 @@ void FrameBuffer::circle_filled3(int xc, int yc, unsigned int radius, Color colo
 
     // Calculate the bounding box of the circle
     int xMin = std::max(0, static_cast<int>(xc) - static_cast<int>(radius));
-    int xMax = std::min(static_cast<int>(DISP_WIDTH) - 1, static_cast<int>(xc) + static_cast<int>(radius));
+    int xMax = std::min(static_cast<int>(c_width) - 1, static_cast<int>(xc) + static_cast<int>(radius));
     int yMin = std::max(0, static_cast<int>(yc) - static_cast<int>(radius));
-    int yMax = std::min(static_cast<int>(DISP_HEIGHT) - 1, static_cast<int>(yc) + static_cast<int>(radius));
+    int yMax = std::min(static_cast<int>(c_height) - 1, static_cast<int>(yc) + static_cast<int>(radius));
 
     // Iterate through each point within the bounding box
     for (y = yMin; y <= yMax; y++) {
@@ -570,14 +677,14 @@ void FrameBuffer::circle_filled3(int xc, int yc, unsigned int radius, Color colo
             if (distance_squared <= radius * radius) {
                 if (distance_squared < (radius - 0.5f) * (radius - 0.5f)) {
                     // Pixel is fully inside the circle, no smoothing needed
-                    if (x >= 0 && x < DISP_WIDTH && y >= 0 && y < DISP_HEIGHT) {
+                    if (x >= 0 && x < (int) c_width && y >= 0 && y < (int) c_height) {
                         point(x, y, color);
                     }
                 } else {
                     // Pixel is on the edge, apply smoothing based on distance from center
                     float distance = sqrt(distance_squared);
                     unsigned char alpha = (1.0f - (distance - (radius - 0.5f))) * 255;
-                    if (x >= 0 && x < DISP_WIDTH && y >= 0 && y < DISP_HEIGHT) {
+                    if (x >= 0 && x < (int) c_width && y >= 0 && y < (int) c_height) {
                         point(x, y, static_cast<Color>((color & 0xFFFFFF) | (alpha << 24)));
                     }
                 }
@@ -718,48 +825,88 @@ void FrameBuffer::blit(int x0, int y0, unsigned int x1, unsigned int y1, unsigne
     if (frame == NULL)
         return;
 
-    uint32_t w;
-    uint32_t h;
+    unsigned int w = width;
+    unsigned int h = height;
+
+    if (!_clip(x0, y0, w, h))
+        return;
+
+    //x1 and y1 theoretically will be always correct, because the caller should
+    //have calculated the cutoff value.
+    this->_setPos(x0, y0);
+    frame->_setPos(x1, y1);
+
+    // inner loop walks along the fast axis of the destination
+    bool rows = Layout::RowMajor == this->c_layout;
+    uint32_t outer = rows ? h : w;
+    uint32_t inner = rows ? w : h;
+    int dstInner = rows ? this->c_stepX : this->c_stepY;
+    int dstOuter = rows ? this->c_stepY : this->c_stepX;
+    int srcInner = rows ? frame->c_stepX : frame->c_stepY;
+    int srcOuter = rows ? frame->c_stepY : frame->c_stepX;
+    Color *dst = this->m_position;
+    Color *src = frame->m_position;
+
+    while (outer--)
+    {
+        Color *s = src;
+
+        this->m_position = dst;
+        for (uint32_t i = 0; i < inner; i++)
+        {
+            this->_setColor(*s);
+            (this->*m_dotFunc)();
+            this->m_position += dstInner;
+            s += srcInner;
+        }
+        dst += dstOuter;
+        src += srcOuter;
+    }
+}
+
+void FrameBuffer::blit(int x0, int y0, unsigned int x1, unsigned int y1, unsigned int width, unsigned int height, const Sprite *sprite)
+{
+    if (sprite == NULL || !_clip(x0, y0, width, height))
+        return;
+
+    // x1 and y1 are expected to be adjusted by the caller like above
+    _setPos(x0, y0);
+    if (Layout::RowMajor == c_layout)
+        sprite->blitTo(m_position, c_stepY, x1, y1, width, height, true);
+    else
+        sprite->blitTo(m_position, c_stepX, x1, y1, width, height, false);
+}
+
+// limit area at x0,y0 to the frame; negative positions are moved to 0 and must be cut off by the caller
+bool FrameBuffer::_clip(int &x0, int &y0, unsigned int &width, unsigned int &height)
+{
+    if (x0 >= (int)c_width || y0 >= (int)c_height)
+        return false;
 
     if (x0 < 0)
     {
-        w = MIN(width, this->c_width);
+        width = MIN(width, c_width);
         x0 = 0;
     }
     else
-        w = MIN(width, this->c_width - x0);
+        width = MIN(width, c_width - x0);
 
     if (y0 < 0)
     {
-        h = MIN(height, this->c_height);
+        height = MIN(height, c_height);
         y0 = 0;
     }
     else
-        h = MIN(height, this->c_height - y0);
+        height = MIN(height, c_height - y0);
 
-    //x1 and y1 theoretically will be always correct, because the caller should
-    //have calculated the cutoff value.
-    uint32_t xs = x1;
-
-    while (w)
-    {
-        this->_setPos(x0, y0);
-        frame->_setPos(xs, y1);
-        for (uint32_t y = 0; y < h; y++)
-        {
-            this->_setColor((Color)*frame->m_position);
-            (this->*m_dotFunc)();
-            this->m_position++;
-            frame->m_position++;
-        }
-        x0++;
-        xs++;
-        w--;
-    }
+    return width && height;
 }
 
 void FrameBuffer::_char(unsigned int x0, unsigned int y0, const char c, const Font &font, Color foreG, Color backG)
 {
+    // scanlines completely inside are walked by pointer, others are clipped per dot
+    bool inside = ((int)x0 >= 0) && (x0 + font.getWidth() <= c_width);
+
     for (unsigned int line = 0; line < font.getHeight(); line++)
     {
         const uint8_t *pAlpha = font.getData(c, line);
@@ -770,12 +917,17 @@ void FrameBuffer::_char(unsigned int x0, unsigned int y0, const char c, const Fo
         }
         else
         {
+            bool walk = inside && (y0 + line < c_height);
+
+            this->_setPos(x0, y0 + line);
             for (unsigned int col = 0; col < font.getWidth(); col++)
             {
-                this->_setPos(x0 + col, y0 + line);
+                if (!walk)
+                    this->_setPos(x0 + col, y0 + line);
                 if (Color::Opaque == backG)
                 {
-                    this->point(x0 + col, y0 + line, colorCombineAlphaI(foreG, *pAlpha));
+                    this->_setColor(colorCombineAlphaI(foreG, *pAlpha));
+                    (this->*m_dotFunc)();
                 }
                 else
                 {
@@ -783,6 +935,8 @@ void FrameBuffer::_char(unsigned int x0, unsigned int y0, const char c, const Fo
                     this->m_col = colorAlphaBlend(colorSetAlphaI(foreG, *pAlpha), backG);
                     this->_dot();
                 }
+                if (walk)
+                    this->m_position += c_stepX;
                 pAlpha++;
             }
         }
@@ -808,10 +962,10 @@ void FrameBuffer::line_thick(unsigned int x0, unsigned int y0,
                              unsigned int x1, unsigned int y1,
                              unsigned int thickness, Color color)
 {
-    if (x0 > DISP_WIDTH)  x0 = DISP_WIDTH;
-    if (x1 > DISP_WIDTH)  x1 = DISP_WIDTH;
-    if (y0 > DISP_HEIGHT) y0 = DISP_HEIGHT;
-    if (y1 > DISP_HEIGHT) y0 = DISP_HEIGHT;
+    if (x0 > c_width)  x0 = c_width;
+    if (x1 > c_width)  x1 = c_width;
+    if (y0 > c_height) y0 = c_height;
+    if (y1 > c_height) y0 = c_height;
 
     int dx = std::abs(static_cast<int>(x1 - x0));
     int dy = std::abs(static_cast<int>(y1 - y0));
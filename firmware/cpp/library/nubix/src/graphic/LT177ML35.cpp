@@ -39,6 +39,7 @@ using namespace std;
 #include <hardware/dma.h>
 #include <hardware/clocks.h>
 #include <hardware/pwm.h>
+#include <hardware/irq.h>
 
 #include "graphic/Display.hpp"
 #include "graphic/LT177ML35.hpp"
@@ -48,6 +49,11 @@ using namespace std;
 
 static critical_section_t _criticalLock;
 
+// updated by TE interrupt
+static volatile uint32_t _teLastUs = 0;
+static volatile uint32_t _tePeriodUs = 0;
+static volatile uint32_t _teCount = 0;
+
 __attribute__((constructor)) // called before main()
 static void
 _prepareCriticalSection()
@@ -56,7 +62,7 @@ _prepareCriticalSection()
 }
 
 LT177ML35::LT177ML35()
-    : c_pio(pio0)
+    : c_pio(pio0), m_frameRate(FrameRate::Rate_29_9Hz), m_layout(Layout::ColumnMajor), m_areaLayout(Layout::ColumnMajor), m_lastPresentUs(0), m_presentPeriodUs(0)
 {
     gpio_init(OPNIC_LCD_CSN);
     gpio_set_dir(OPNIC_LCD_CSN, GPIO_OUT);
@@ -106,10 +112,8 @@ void LT177ML35::init()
     writeCmd(0xb6);  // frame rate enable access
     writeData(0x01); // Frame_Rate_Set enabled
 
-    writeCmd(0xa3);  // Frame_Rate_Set
-    writeData(0x42); // 0x11 = 59.9 Hz
-                     // 0x1a = 50.6 Hz
-                     // 0x42 = 29.9 Hz
+    writeCmd(0xa3); // Frame_Rate_Set, see FrameRate
+    writeData((uint8_t)m_frameRate);
 
     writeCmd(0x35);  // Tearing Effect Line ON
     writeData(0x00); // only V-Blanking (360µs@30Hz, high active)
@@ -119,7 +123,7 @@ void LT177ML35::init()
 
     writeCmd(0x21); // Display Inversion ON
 
-    writeCmd(0x36);  // Memory Access Ctrl
+    writeCmd(0x36);  // Memory Access Ctrl, see setLayout()
     writeData(0x98); // 0x90 = upward, leftside, normal mode, reverse refresh, RGB color filter panel
                      // 0xd8 = upward, rightside, normal mode, reverse refresh, BGR color filter panel
                      // 0x78 = downward, leftside, reverse mode, reverse refresh, BGR color filter panel
@@ -172,6 +176,7 @@ void LT177ML35::init()
     sleep_ms(120);
 
     writeCmd(0x29); // Display on
+    initTE();
     initPWM(OPNIC_LCD_BACKLIGHT);
     setBrightness(60);
     initPWM(OPNIC_LED_RED);
@@ -189,6 +194,33 @@ void LT177ML35::init()
     dma_channel_set_config(m_dmaTX, &conf, false);
 }
 
+static void _teIrqHandler(void)
+{
+    if (!(gpio_get_irq_event_mask(OPNIC_LCD_TE) & GPIO_IRQ_EDGE_RISE))
+        return; // shared GPIO interrupt raised by another pin
+    gpio_acknowledge_irq(OPNIC_LCD_TE, GPIO_IRQ_EDGE_RISE);
+
+    uint32_t now = time_us_32();
+    uint32_t period = now - _teLastUs;
+    _teLastUs = now;
+    if (period < 100000) // skip first edge and gaps caused by frame rate changes
+    {
+        if (_tePeriodUs)
+            _tePeriodUs = (int32_t)_tePeriodUs + ((int32_t)period - (int32_t)_tePeriodUs) / 8;
+        else
+            _tePeriodUs = period;
+    }
+    _teCount = _teCount + 1;
+    __sev(); // wake up waitForVSync() on both cores
+}
+
+void LT177ML35::initTE()
+{
+    gpio_add_raw_irq_handler(OPNIC_LCD_TE, _teIrqHandler);
+    gpio_set_irq_enabled(OPNIC_LCD_TE, GPIO_IRQ_EDGE_RISE, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
 void LT177ML35::initPIO(void)
 {
     const uint16_t cPioInstructions[] = {
@@ -266,29 +298,135 @@ void inline LT177ML35::writeData(uint8_t data)
 // performed in 2.45ms per frame
 void LT177ML35::update(uint32_t *frameBuffer, uint32_t pixelCount, bool vSync)
 {
-    writeCmd(0x2a); // set column address
-    writeData(0);   // column start
-    writeData(0);
-    writeData(0); // column end
-    writeData(DISP_HEIGHT - 1);
-    writeCmd(0x2b); // set row address
-    writeData(0);   // row start
-    writeData(0);
-    writeData(0); // row end
-    writeData(DISP_WIDTH - 1);
-    writeCmd(0x2c); // write memory
+    // panel is 128 columns by 160 rows; with row/column exchange the address ranges swap too
+    unsigned int columns = Layout::RowMajor == m_layout ? DISP_WIDTH : DISP_HEIGHT;
+    unsigned int rows = Layout::RowMajor == m_layout ? DISP_HEIGHT : DISP_WIDTH;
 
-    while (vSync && gpio_get(OPNIC_LCD_TE)) // wait when TE is already raised; we are too late for this frame
-        tight_loop_contents();
-    while (vSync && !gpio_get(OPNIC_LCD_TE)) // wait until TE is raised
-        tight_loop_contents();
+    setAddress(0, 0, columns, rows);
+
+    if (vSync) // when TE is already raised we are too late for this frame and wait for the next one
+        waitForVSync();
     dma_channel_set_read_addr(m_dmaTX, frameBuffer, false);
     dma_channel_set_write_addr(m_dmaTX, &c_pio->txf[m_sm_dat3_bgr], false);
     dma_channel_set_trans_count(m_dmaTX, pixelCount, true);
+
+    uint32_t now = time_us_32();
+    uint32_t period = now - m_lastPresentUs;
+    m_lastPresentUs = now;
+    if (period < 1000000) // skip first frame and paused rendering
+    {
+        if (m_presentPeriodUs)
+            m_presentPeriodUs = (int32_t)m_presentPeriodUs + ((int32_t)period - (int32_t)m_presentPeriodUs) / 8;
+        else
+            m_presentPeriodUs = period;
+    }
+
     dma_channel_wait_for_finish_blocking(m_dmaTX);
     // 25 MByte/s is the fastest TX we can achieve with this display without glitches
 }
 
+// column-major pixels go through the ColumnMajor layout, there a panel row is an x and a panel column a y
+void LT177ML35::beginArea(unsigned int x, unsigned int y, unsigned int width, unsigned int height, bool vSync)
+{
+    m_areaLayout = m_layout;
+    setLayout(Layout::ColumnMajor);
+    setAddress(y, x, height, width);
+
+    if (vSync)
+        waitForVSync();
+}
+
+// waits only for the previous part, so the caller prepares the next part during this transfer
+void LT177ML35::writeArea(const uint32_t *pixels, uint32_t pixelCount)
+{
+    dma_channel_wait_for_finish_blocking(m_dmaTX);
+    dma_channel_set_read_addr(m_dmaTX, pixels, false);
+    dma_channel_set_write_addr(m_dmaTX, &c_pio->txf[m_sm_dat3_bgr], false);
+    dma_channel_set_trans_count(m_dmaTX, pixelCount, true);
+}
+
+void LT177ML35::endArea(void)
+{
+    dma_channel_wait_for_finish_blocking(m_dmaTX);
+    setLayout(m_areaLayout);
+}
+
+// following pixels fill the window row by row of the panel
+void LT177ML35::setAddress(unsigned int column, unsigned int row, unsigned int columns, unsigned int rows)
+{
+    writeCmd(0x2a); // set column address
+    writeData((column >> 8) & 0xff); // column start
+    writeData(column & 0xff);
+    writeData(((column + columns - 1) >> 8) & 0xff); // column end
+    writeData((column + columns - 1) & 0xff);
+    writeCmd(0x2b); // set row address
+    writeData((row >> 8) & 0xff); // row start
+    writeData(row & 0xff);
+    writeData(((row + rows - 1) >> 8) & 0xff); // row end
+    writeData((row + rows - 1) & 0xff);
+    writeCmd(0x2c); // write memory
+}
+
+// pixels are written column by column of the panel in RowMajor layout, while the panel refreshes
+// row by row; this may show a tearing line within the first rows even with vSync
+void LT177ML35::setLayout(Layout layout)
+{
+    if (layout == m_layout)
+        return;
+
+    writeCmd(0x36); // Memory Access Ctrl
+    if (Layout::RowMajor == layout)
+        writeData(0xb8); // like 0x98 plus row/column exchange
+    else
+        writeData(0x98);
+    m_layout = layout;
+}
+
+void LT177ML35::setFrameRate(FrameRate rate)
+{
+    writeCmd(0xfe); // set Inter_command high with this sequence
+    writeCmd(0xfe);
+    writeCmd(0xef);
+
+    writeCmd(0xb6);  // frame rate enable access
+    writeData(0x01); // Frame_Rate_Set enabled
+
+    writeCmd(0xa3); // Frame_Rate_Set
+    writeData((uint8_t)rate & 0x7f);
+
+    writeCmd(0xfe); // set Inter_command low with this sequence
+    writeCmd(0xff);
+
+    m_frameRate = (FrameRate)((uint8_t)rate & 0x7f); // what the panel runs at
+    _tePeriodUs = 0; // measure again
+}
+
+uint32_t LT177ML35::getFramePeriodUs() const
+{
+    uint32_t period = _tePeriodUs;
+
+    if (period)
+        return period;
+    // nominal: 2937.6Hz / (value + 32)
+    return ((uint32_t)m_frameRate + 32) * 10000000 / 29376;
+}
+
+uint32_t LT177ML35::getPresentRate() const
+{
+    uint32_t period = m_presentPeriodUs;
+
+    return period ? 1000000000 / period : 0;
+}
+
+// sleeps with WFE, wake up is signaled by TE interrupt
+void LT177ML35::waitForVSync() const
+{
+    uint32_t count = _teCount;
+
+    while (count == _teCount)
+        __wfe();
+}
+
 void LT177ML35::initPWM(unsigned int pin)
 {
     unsigned int slice, channel;
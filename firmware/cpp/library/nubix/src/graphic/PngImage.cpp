@@ -35,88 +35,138 @@
  *******************************************************************************/
 
 #include <pico/mutex.h>
+#include <pico/platform.h>
 
 #include "graphic/PngImage.hpp"
 #include "common/endian.hpp"
 
-auto_init_mutex(render_mutex);
+// one decoder per core, so the cores never wait for each other; kept to not fragment the heap
+static pngle_t *_decoders[NUM_CORES];
+static bool _decoding[NUM_CORES];
+auto_init_mutex(decoder_mutex);
 
-static FrameBuffer *_buffer;
+/**
+ * @brief Destination of one decode, handed to the callback as pngle user data
+ */
+struct RenderTarget
+{
+    FrameBuffer *buffer;
+    Sprite *sprite;
+    int x, y;
+};
+
+static void _row(pngle_t *pngle, uint32_t x, uint32_t y, uint32_t step, uint32_t n, const uint8_t *rgba)
+{
+    RenderTarget *target = (RenderTarget *)pngle_get_user_data(pngle);
+
+    if (target->sprite)
+        target->sprite->setRow(x, y, step, n, rgba);
+    else
+        target->buffer->row_rgba(x + target->x, y + target->y, step, n, rgba);
+}
+
+// decoder of the calling core, allocated on first use
+static pngle_t *_acquire(void)
+{
+    const uint core = get_core_num();
+
+    mutex_enter_blocking(&decoder_mutex);
+    if (NULL == _decoders[core])
+        _decoders[core] = pngle_new();
+    _decoding[core] = true;
+    mutex_exit(&decoder_mutex);
+
+    return _decoders[core];
+}
+
+static void _release(void)
+{
+    mutex_enter_blocking(&decoder_mutex);
+    _decoding[get_core_num()] = false;
+    mutex_exit(&decoder_mutex);
+}
 
 PngImage::PngImage(const uint32_t *pngData, uint32_t pngSize)
     : c_pData(pngData),
       c_dataSize(pngSize)
 {
-    m_pngHandle = pngle_new();
 }
 
 PngImage::~PngImage(void)
 {
-    pngle_destroy(m_pngHandle);
-    m_pngHandle = nullptr;
 }
 
-void PngImage::render(FrameBuffer &buffer, uint32_t x, uint32_t y)
+bool PngImage::_decode(FrameBuffer *buffer, Sprite *sprite, int x, int y)
 {
-    int fed;
+    RenderTarget target = {buffer, sprite, x, y};
     size_t remain = c_dataSize;
     const uint8_t *pData = (uint8_t *)c_pData;
-    static uint32_t x_offset, y_offset;
-
-    if (x > buffer.get_width() || y > buffer.get_height())
-        return;
-
-    mutex_enter_blocking(&render_mutex); // only one instance can render an image
-    _buffer = &buffer;
-    x_offset = x;
-    y_offset = y;
-    pngle_reset(m_pngHandle);
-    pngle_set_draw_callback(m_pngHandle, [](pngle_t *pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) -> void
-                            {
-        argb_t temp = {{.blue = rgba[2], .green = rgba[1], .red = rgba[0], .alpha = rgba[3]}};
+    pngle_t *pngle = _acquire();
 
-        _buffer->point(x + x_offset,y + y_offset,(Color)temp.raw); });
+    pngle_reset(pngle);
+    pngle_set_row_callback(pngle, _row);
+    pngle_set_user_data(pngle, &target);
     while (remain)
     {
-        fed = pngle_feed(m_pngHandle, pData, remain);
+        int fed = pngle_feed(pngle, pData, remain);
         if (fed <= 0)
             break;
         pData += fed;
         remain -= fed;
     }
-    mutex_exit(&render_mutex);
+    pngle_reset(pngle); // give back scanline and palette buffers
+    _release();
+
+    return 0 == remain;
+}
+
+void PngImage::releaseDecoders(void)
+{
+    mutex_enter_blocking(&decoder_mutex);
+    for (int i = 0; i < NUM_CORES; i++)
+    {
+        if (_decoding[i])
+            continue;
+        pngle_destroy(_decoders[i]); // the inflate window alone takes 32 KB
+        _decoders[i] = NULL;
+    }
+    mutex_exit(&decoder_mutex);
+}
+
+void PngImage::render(FrameBuffer &buffer, uint32_t x, uint32_t y)
+{
+    if (x > buffer.get_width() || y > buffer.get_height())
+        return;
+
+    _decode(&buffer, NULL, x, y);
 }
 
 FrameBuffer* PngImage::render(void)
 {
-    int fed;
-    size_t remain = c_dataSize;
-    const uint8_t *pData = (uint8_t *)c_pData;
+    FrameBuffer *buffer = new FrameBuffer(widthGet(), heightGet());
 
-    mutex_enter_blocking(&render_mutex); // only one instance can render an image
-    pngle_reset(m_pngHandle);
-    pngle_set_init_callback(m_pngHandle, [](pngle_t *pngle, uint32_t w, uint32_t h) -> void {
-        _buffer = new FrameBuffer(w, h);
-        _buffer->clear(Color::Opaque);
-    });
-    pngle_set_draw_callback(m_pngHandle, [](pngle_t *pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) -> void
-                            {
-        argb_t temp = {{.blue = rgba[2], .green = rgba[1], .red = rgba[0], .alpha = rgba[3]}};
-
-        _buffer->point(x,y,(Color)temp.raw); });
-    while (remain)
-    {
-        fed = pngle_feed(m_pngHandle, pData, remain);
-        if (fed <= 0) { //decode error :(
-            delete _buffer;
-            _buffer = NULL;
-            break;
-        }
-        pData += fed;
-        remain -= fed;
+    buffer->clear(Color::Opaque);
+    if (!_decode(buffer, NULL, 0, 0)) { //decode error :(
+        delete buffer;
+        buffer = NULL;
+    }
+    return buffer;
+}
+
+bool PngImage::render(Sprite &sprite)
+{
+    return _decode(NULL, &sprite, 0, 0);
+}
+
+Sprite *PngImage::render(PixelFormat format)
+{
+    Sprite *sprite = new Sprite(widthGet(), heightGet(), format);
+
+    if (!render(*sprite)) { //decode error :(
+        delete sprite;
+        sprite = NULL;
     }
-    mutex_exit(&render_mutex);
-    return _buffer;
+    return sprite;
 }
 
 uint32_t PngImage::widthGet(void) const {
@@ -0,0 +1,411 @@
+/*******************************************************************************
+ * @file Sprite.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief sprite surfaces with compact pixel formats
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include <algorithm>
+#include <cstring>
+
+#include "graphic/Sprite.hpp"
+#include "graphic/SpriteDecoder.hpp"
+
+Sprite::Sprite(unsigned int width, unsigned int height, PixelFormat format)
+    : c_width(width),
+      c_height(height),
+      c_format(format),
+      c_ownData(true),
+      c_pitch(height),
+      c_offset(0),
+      m_tint(Color::White)
+{
+    unsigned int words = (get_size() + 3) / 4;
+
+    m_data = new uint32_t[words];
+    memset(m_data, 0, words * 4); // transparent, or black for RGB565
+}
+
+Sprite::Sprite(unsigned int width, unsigned int height, PixelFormat format, const void *pixels)
+    : c_width(width),
+      c_height(height),
+      c_format(format),
+      c_ownData(false),
+      c_pitch(height),
+      c_offset(0),
+      m_data((uint32_t *)pixels), // never written, see c_ownData
+      m_tint(Color::White)
+{
+}
+
+Sprite::Sprite(const Sprite &atlas, const SpriteRect &rect)
+    : c_width(rect.width),
+      c_height(rect.height),
+      c_format(atlas.c_format),
+      c_ownData(false),
+      c_pitch(atlas.c_pitch),
+      c_offset(atlas.c_offset + rect.x * atlas.c_pitch + rect.y),
+      m_data(atlas.m_data),
+      m_tint(atlas.m_tint)
+{
+}
+
+Sprite::~Sprite(void)
+{
+    if (c_ownData)
+        delete[] m_data;
+}
+
+// NULL when the blob is damaged, raw pixels must fill the whole sprite
+static const SpriteBlob *_header(const uint32_t *blob, uint32_t size)
+{
+    const SpriteBlob *header = (const SpriteBlob *)blob;
+
+    if (NULL == blob || size < sizeof(SpriteBlob) || SPRITE_BLOB_MAGIC != header->magic ||
+        header->format > (uint8_t)PixelFormat::A8 || size - sizeof(SpriteBlob) < header->size)
+        return NULL;
+    if (0 == header->encoding &&
+        header->size != header->width * header->height * Sprite::bytesPerPixel((PixelFormat)header->format))
+        return NULL;
+    return header;
+}
+
+Sprite *Sprite::load(const uint32_t *blob, uint32_t size)
+{
+    const SpriteBlob *header = _header(blob, size);
+
+    if (NULL == header)
+        return NULL;
+
+    PixelFormat format = (PixelFormat)header->format;
+    const uint8_t *payload = (const uint8_t *)(header + 1);
+
+    if (0 == header->encoding)
+        return new Sprite(header->width, header->height, format, payload);
+
+    Sprite *sprite = new Sprite(header->width, header->height, format);
+    bool valid = false;
+
+    if (1 == header->encoding)
+    {
+        valid = sprite->_unpack(payload, header->size);
+    }
+    else if (2 == header->encoding)
+    {
+        SpriteDecoder decoder(format);
+        const uint8_t *src = payload;
+        unsigned int count = header->width * header->height;
+
+        valid = count == decoder.decode(src, payload + header->size, sprite->m_data, count) &&
+                src == payload + header->size;
+    }
+    if (!valid)
+    {
+        delete sprite;
+        sprite = NULL;
+    }
+    return sprite;
+}
+
+// the display shows band n while band n + 1 is decoded into the other half of the buffer
+bool Sprite::stream(const uint32_t *blob, uint32_t size, Display &display, Color background)
+{
+    const SpriteBlob *header = _header(blob, size);
+    const unsigned int width = display.getWidth();
+    const unsigned int height = display.getHeight();
+
+    if (NULL == header || 1 == header->encoding || header->encoding > 2 ||
+        header->width > width || header->height > height)
+        return false;
+
+    const PixelFormat format = (PixelFormat)header->format;
+    const uint8_t *payload = (const uint8_t *)(header + 1);
+    const uint8_t *src = payload;
+    const unsigned int x0 = (width - header->width) / 2;
+    const unsigned int y0 = (height - header->height) / 2;
+    const unsigned int bandSize = SPRITE_STREAM_COLUMNS * height;
+    Color *bands = new Color[2 * bandSize];
+    uint32_t *pixels = new uint32_t[(SPRITE_STREAM_COLUMNS * header->height * bytesPerPixel(format) + 3) / 4];
+    SpriteDecoder decoder(format);
+    bool valid = true;
+
+    display.beginArea(0, 0, width, height, true);
+    for (unsigned int x = 0, n = 0; x < width; x += SPRITE_STREAM_COLUMNS, n++)
+    {
+        Color *band = bands + (n & 1) * bandSize;
+        unsigned int columns = std::min(SPRITE_STREAM_COLUMNS, width - x);
+        unsigned int first = std::max(x, x0);
+        unsigned int last = std::min(x + columns, x0 + header->width);
+
+        std::fill(band, band + columns * height, background);
+        if (first < last)
+        {
+            Color *dst = band + (first - x) * height + y0;
+
+            if (0 == header->encoding)
+            {
+                Sprite image(header->width, header->height, format, payload);
+                image.blitTo(dst, height, first - x0, 0, last - first, header->height, false);
+            }
+            else
+            {
+                unsigned int count = (last - first) * header->height;
+                valid = valid && count == decoder.decode(src, payload + header->size, pixels, count);
+
+                Sprite part(last - first, header->height, format, pixels);
+                if (valid)
+                    part.blitTo(dst, height, 0, 0, last - first, header->height, false);
+            }
+        }
+        display.writeArea((const uint32_t *)band, columns * height);
+    }
+    display.endArea();
+
+    delete[] pixels;
+    delete[] bands;
+    return valid;
+}
+
+// control byte c < 0x80: c + 1 literal pixels follow, else the next pixel repeats c - 0x7e times
+bool Sprite::_unpack(const uint8_t *src, uint32_t size)
+{
+    const unsigned int bpp = bytesPerPixel(c_format);
+    const uint8_t *srcEnd = src + size;
+    uint8_t *dst = (uint8_t *)m_data;
+    uint8_t *dstEnd = dst + get_size();
+
+    while (src < srcEnd)
+    {
+        uint8_t c = *src++;
+
+        if (c < 0x80)
+        {
+            unsigned int bytes = (c + 1) * bpp;
+
+            if (bytes > (unsigned int)(srcEnd - src) || bytes > (unsigned int)(dstEnd - dst))
+                return false;
+            memcpy(dst, src, bytes);
+            src += bytes;
+            dst += bytes;
+        }
+        else
+        {
+            unsigned int count = c - 0x7e;
+
+            if (bpp > (unsigned int)(srcEnd - src) || count * bpp > (unsigned int)(dstEnd - dst))
+                return false;
+            while (count--)
+            {
+                memcpy(dst, src, bpp);
+                dst += bpp;
+            }
+            src += bpp;
+        }
+    }
+    return dst == dstEnd;
+}
+
+void Sprite::point(unsigned int x, unsigned int y, Color color)
+{
+    if (x >= c_width || y >= c_height || !c_ownData)
+        return;
+
+    unsigned int index = c_offset + x * c_pitch + y;
+    argb_t in;
+
+    in.raw = color;
+    switch (c_format)
+    {
+    case PixelFormat::ARGB8888:
+        m_data[index] = color;
+        break;
+    case PixelFormat::ARGB8888Pre:
+        in.red = in.red * in.alpha / 255;
+        in.green = in.green * in.alpha / 255;
+        in.blue = in.blue * in.alpha / 255;
+        m_data[index] = in.raw;
+        break;
+    case PixelFormat::ARGB4444:
+        ((uint16_t *)m_data)[index] = (in.alpha >> 4) << 12 | (in.red >> 4) << 8 | (in.green >> 4) << 4 | in.blue >> 4;
+        break;
+    case PixelFormat::RGB565:
+        ((uint16_t *)m_data)[index] = (in.red >> 3) << 11 | (in.green >> 2) << 5 | in.blue >> 3;
+        break;
+    case PixelFormat::A8:
+        ((uint8_t *)m_data)[index] = in.alpha;
+        break;
+    }
+}
+
+// the format is checked once per row, the sprite is column-major so a row advances by c_pitch
+void Sprite::setRow(unsigned int x, unsigned int y, unsigned int step, unsigned int count, const uint8_t *rgba)
+{
+    if (y >= c_height || x >= c_width || 0 == step || !c_ownData)
+        return;
+    count = std::min(count, (c_width - x + step - 1) / step);
+
+    unsigned int index = c_offset + x * c_pitch + y;
+    unsigned int inc = step * c_pitch;
+
+    switch (c_format)
+    {
+    case PixelFormat::ARGB8888:
+        for (; count--; index += inc, rgba += 4)
+            m_data[index] = colorFromRGBA(rgba);
+        break;
+    case PixelFormat::ARGB8888Pre:
+        for (; count--; index += inc, rgba += 4)
+        {
+            uint32_t a = rgba[3];
+            m_data[index] = a << 24 | (rgba[0] * a / 255) << 16 | (rgba[1] * a / 255) << 8 | rgba[2] * a / 255;
+        }
+        break;
+    case PixelFormat::ARGB4444:
+        for (; count--; index += inc, rgba += 4)
+            ((uint16_t *)m_data)[index] = (rgba[3] >> 4) << 12 | (rgba[0] >> 4) << 8 | (rgba[1] >> 4) << 4 | rgba[2] >> 4;
+        break;
+    case PixelFormat::RGB565:
+        for (; count--; index += inc, rgba += 4)
+            ((uint16_t *)m_data)[index] = (rgba[0] >> 3) << 11 | (rgba[1] >> 2) << 5 | rgba[2] >> 3;
+        break;
+    case PixelFormat::A8:
+        for (; count--; index += inc, rgba += 4)
+            ((uint8_t *)m_data)[index] = rgba[3];
+        break;
+    }
+}
+
+// walks all lines of the area, dots of a line are consecutive in the destination
+template <typename T, typename Op>
+static inline void _kernel(Color *dst, int dstOuter, const T *src, int srcInner, int srcOuter,
+                           unsigned int inner, unsigned int outer, Op op)
+{
+    while (outer--)
+    {
+        Color *d = dst;
+        const T *s = src;
+
+        for (unsigned int i = inner; i; i--)
+        {
+            op(d, *s);
+            d++;
+            s += srcInner;
+        }
+        dst += dstOuter;
+        src += srcOuter;
+    }
+}
+
+// d = s + d * (1 - alpha of s); for premultiplied colors
+static inline Color _blendPre(uint32_t s, uint32_t d)
+{
+    uint32_t na = 255 - (s >> 24);
+    uint32_t rb = (((d & 0x00ff00ff) * na) >> 8) & 0x00ff00ff;
+    uint32_t ag = (((d >> 8) & 0x00ff00ff) * na) & 0xff00ff00;
+
+    return (Color)(s + rb + ag);
+}
+
+static inline void _blendStraight(Color *d, uint32_t s)
+{
+    uint32_t a = s >> 24;
+
+    if (0xff == a)
+        *d = (Color)s;
+    else if (a)
+        *d = colorAlphaBlend((Color)s, *d);
+}
+
+// one kernel per format, the format is not checked per dot
+void Sprite::blitTo(Color *dst, int dstOuter, unsigned int x1, unsigned int y1, unsigned int width, unsigned int height, bool rows) const
+{
+    unsigned int first = c_offset + x1 * c_pitch + y1;
+    int srcInner = rows ? c_pitch : 1;
+    int srcOuter = rows ? 1 : c_pitch;
+    unsigned int inner = rows ? width : height;
+    unsigned int outer = rows ? height : width;
+
+    switch (c_format)
+    {
+    case PixelFormat::ARGB8888:
+        _kernel(dst, dstOuter, m_data + first, srcInner, srcOuter, inner, outer,
+                [](Color *d, uint32_t s)
+                { _blendStraight(d, s); });
+        break;
+
+    case PixelFormat::ARGB8888Pre:
+        _kernel(dst, dstOuter, m_data + first, srcInner, srcOuter, inner, outer,
+                [](Color *d, uint32_t s)
+                {
+                    if (0xff000000 == (s & 0xff000000))
+                        *d = (Color)s;
+                    else if (s)
+                        *d = _blendPre(s, *d);
+                });
+        break;
+
+    case PixelFormat::ARGB4444:
+        _kernel(dst, dstOuter, (const uint16_t *)m_data + first, srcInner, srcOuter, inner, outer,
+                [](Color *d, uint16_t s)
+                {
+                    if (s < 0x1000) // fully transparent
+                        return;
+                    // widen every nibble n to n * 17 at once
+                    uint32_t c = (s & 0xf000) << 12 | (s & 0x0f00) << 8 | (s & 0x00f0) << 4 | (s & 0x000f);
+                    _blendStraight(d, c | c << 4);
+                });
+        break;
+
+    case PixelFormat::RGB565:
+        _kernel(dst, dstOuter, (const uint16_t *)m_data + first, srcInner, srcOuter, inner, outer,
+                [](Color *d, uint16_t s)
+                {
+                    uint32_t r = (s >> 11) & 0x1f, g = (s >> 5) & 0x3f, b = s & 0x1f;
+                    *d = (Color)(0xff000000 | (r << 3 | r >> 2) << 16 | (g << 2 | g >> 4) << 8 | (b << 3 | b >> 2));
+                });
+        break;
+
+    case PixelFormat::A8:
+    {
+        const uint32_t tint = m_tint;
+        const uint32_t tintAlpha = tint >> 24;
+
+        _kernel(dst, dstOuter, (const uint8_t *)m_data + first, srcInner, srcOuter, inner, outer,
+                [tint, tintAlpha](Color *d, uint8_t s)
+                {
+                    uint32_t a = 0xff == tintAlpha ? s : s * tintAlpha / 255;
+                    if (0xff == a)
+                        *d = (Color)tint;
+                    else if (a)
+                        *d = colorAlphaBlend((Color)((tint & 0x00ffffff) | a << 24), *d);
+                });
+        break;
+    }
+    }
+}
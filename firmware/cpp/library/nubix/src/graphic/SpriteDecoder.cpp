@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * @file SpriteDecoder.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief streaming decoder of QOI style sprite blobs
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include <cstring>
+
+#include "graphic/SpriteDecoder.hpp"
+
+#define OP_DIFF 0x40
+#define OP_LUMA 0x80
+#define OP_RUN 0xc0
+#define OP_RGB 0xfe
+#define OP_RGBA 0xff
+
+static inline unsigned int _hash(uint32_t px)
+{
+    return ((px >> 16 & 0xff) * 3 + (px >> 8 & 0xff) * 5 + (px & 0xff) * 7 + (px >> 24) * 11) & 63;
+}
+
+// adds dr, dg, db to the color bytes, every byte wraps around on its own
+static inline uint32_t _add(uint32_t px, int dr, int dg, int db)
+{
+    uint32_t d = (uint32_t)(dr & 0xff) << 16 | (uint32_t)(dg & 0xff) << 8 | (uint32_t)(db & 0xff);
+
+    return (px & 0xff000000) | (((px & 0x00ff00ff) + (d & 0x00ff00ff)) & 0x00ff00ff) |
+           (((px & 0x0000ff00) + (d & 0x0000ff00)) & 0x0000ff00);
+}
+
+SpriteDecoder::SpriteDecoder(PixelFormat format)
+    : c_format(format)
+{
+    reset();
+}
+
+void SpriteDecoder::reset(void)
+{
+    m_prev = 0xff000000;
+    m_run = 0;
+    memset(m_index, 0, sizeof(m_index));
+}
+
+// the pixel format is only seen by pack, runs write the packed pixel without unpacking again
+template <typename T, typename Pack>
+unsigned int SpriteDecoder::_decode(const uint8_t *&src, const uint8_t *srcEnd, T *dst, unsigned int count, Pack pack)
+{
+    T *d = dst;
+    T *end = dst + count;
+    const uint8_t *s = src;
+    uint32_t px = m_prev;
+    unsigned int run = m_run;
+    T out = pack(px);
+
+    while (d < end)
+    {
+        if (run)
+        {
+            unsigned int n = run < (unsigned int)(end - d) ? run : end - d;
+
+            run -= n;
+            while (n--)
+                *d++ = out;
+            continue;
+        }
+        if (s >= srcEnd)
+            break;
+
+        uint8_t b1 = *s;
+
+        if (b1 < OP_DIFF)
+        {
+            px = m_index[b1];
+            s++;
+        }
+        else if (b1 < OP_LUMA)
+        {
+            px = _add(px, (b1 >> 4 & 3) - 2, (b1 >> 2 & 3) - 2, (b1 & 3) - 2);
+            m_index[_hash(px)] = px;
+            s++;
+        }
+        else if (b1 < OP_RUN)
+        {
+            if (srcEnd - s < 2)
+                break;
+            int dg = (b1 & 0x3f) - 32;
+            px = _add(px, dg + (s[1] >> 4) - 8, dg, dg + (s[1] & 0x0f) - 8);
+            m_index[_hash(px)] = px;
+            s += 2;
+        }
+        else if (b1 < OP_RGB)
+        {
+            // the run repeats the previous pixel, out is still packed
+            run = (b1 & 0x3f) + 1;
+            s++;
+            continue;
+        }
+        else if (OP_RGB == b1)
+        {
+            if (srcEnd - s < 4)
+                break;
+            px = (px & 0xff000000) | (uint32_t)s[1] << 16 | (uint32_t)s[2] << 8 | s[3];
+            m_index[_hash(px)] = px;
+            s += 4;
+        }
+        else
+        {
+            if (srcEnd - s < 5)
+                break;
+            px = (uint32_t)s[4] << 24 | (uint32_t)s[1] << 16 | (uint32_t)s[2] << 8 | s[3];
+            m_index[_hash(px)] = px;
+            s += 5;
+        }
+        out = pack(px);
+        *d++ = out;
+    }
+
+    src = s;
+    m_prev = px;
+    m_run = run;
+    return d - dst;
+}
+
+unsigned int SpriteDecoder::decode(const uint8_t *&src, const uint8_t *srcEnd, void *dst, unsigned int count)
+{
+    switch (c_format)
+    {
+    case PixelFormat::ARGB8888:
+    case PixelFormat::ARGB8888Pre:
+        return _decode(src, srcEnd, (uint32_t *)dst, count,
+                       [](uint32_t px)
+                       { return px; });
+    case PixelFormat::ARGB4444:
+        return _decode(src, srcEnd, (uint16_t *)dst, count,
+                       [](uint32_t px)
+                       { return (uint16_t)((px >> 12 & 0xf000) | (px >> 8 & 0x0f00) | (px >> 4 & 0x00f0) | (px & 0x000f)); });
+    case PixelFormat::RGB565:
+        return _decode(src, srcEnd, (uint16_t *)dst, count,
+                       [](uint32_t px)
+                       { return (uint16_t)((px >> 5 & 0xf800) | (px >> 3 & 0x07e0) | (px & 0x001f)); });
+    case PixelFormat::A8:
+        return _decode(src, srcEnd, (uint8_t *)dst, count,
+                       [](uint32_t px)
+                       { return (uint8_t)(px >> 8); });
+    }
+    return 0;
+}
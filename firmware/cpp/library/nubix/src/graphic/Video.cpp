@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * @file Video.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief full screen videos streamed from flash
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include <algorithm>
+
+#include <pico/stdlib.h>
+
+#include "graphic/Video.hpp"
+#include "graphic/Sprite.hpp"
+
+// words of a frame including its header and windows
+static inline uint32_t _words(const VideoFrame *frame)
+{
+    return (sizeof(VideoFrame) + frame->windows * sizeof(VideoWindow) + frame->size + 3) / 4;
+}
+
+Video::Video(const VideoBlob &header, const uint32_t *first)
+    : c_width(header.width),
+      c_height(header.height),
+      c_format((PixelFormat)header.format),
+      c_block(header.block),
+      c_frames(header.frames),
+      c_periodUs(header.periodUs),
+      c_first(first),
+      m_decoder((PixelFormat)header.format)
+{
+    rewind();
+}
+
+// all frames and windows are checked once here, so showFrame() only checks the pixels
+Video *Video::load(const uint32_t *blob, uint32_t size)
+{
+    const VideoBlob *header = (const VideoBlob *)blob;
+
+    if (NULL == blob || size < sizeof(VideoBlob) || VIDEO_BLOB_MAGIC != header->magic ||
+        (header->format != (uint8_t)PixelFormat::RGB565 && header->format != (uint8_t)PixelFormat::ARGB8888) ||
+        0 == header->block || 0 == header->frames || 0 == header->periodUs ||
+        size - sizeof(VideoBlob) < header->size)
+        return NULL;
+
+    const uint32_t *payload = (const uint32_t *)(header + 1);
+    const uint32_t *end = payload + header->size / 4;
+    const unsigned int columns = (header->width + header->block - 1) / header->block;
+    const unsigned int rows = (header->height + header->block - 1) / header->block;
+    const uint32_t *p = payload;
+
+    for (unsigned int i = 0; i < header->frames; i++)
+    {
+        const VideoFrame *frame = (const VideoFrame *)p;
+
+        if ((uint32_t)(end - p) < sizeof(VideoFrame) / 4 || (uint32_t)(end - p) < _words(frame))
+            return NULL;
+        const VideoWindow *windows = (const VideoWindow *)(frame + 1);
+        for (unsigned int w = 0; w < frame->windows; w++)
+        {
+            if (0 == windows[w].width || 0 == windows[w].height ||
+                windows[w].x + windows[w].width > columns || windows[w].y + windows[w].height > rows)
+                return NULL;
+        }
+        p += _words(frame);
+    }
+
+    return new Video(*header, payload);
+}
+
+bool Video::showFrame(Display &display)
+{
+    const VideoFrame *frame = (const VideoFrame *)m_next;
+    const VideoWindow *windows = (const VideoWindow *)(frame + 1);
+    const uint8_t *src = (const uint8_t *)(windows + frame->windows);
+    const uint8_t *srcEnd = src + frame->size;
+    bool valid = c_width <= display.getWidth() && c_height <= display.getHeight();
+    const unsigned int x0 = (display.getWidth() - c_width) / 2;
+    const unsigned int y0 = (display.getHeight() - c_height) / 2;
+    unsigned int n = 0;
+
+    // late by more than a frame, e.g. not shown for a while: pace from now on
+    if ((int32_t)(time_us_32() - m_dueUs) > (int32_t)c_periodUs)
+        m_dueUs = time_us_32();
+    while ((int32_t)(m_dueUs - time_us_32()) > 0)
+        tight_loop_contents();
+    m_dueUs += c_periodUs;
+
+    m_decoder.reset();
+    for (unsigned int i = 0; valid && i < frame->windows; i++)
+    {
+        const unsigned int x = windows[i].x * c_block;
+        const unsigned int y = windows[i].y * c_block;
+        const unsigned int width = std::min(windows[i].width * c_block, c_width - x);
+        const unsigned int height = std::min(windows[i].height * c_block, c_height - y);
+
+        // the whole area is sent even with invalid pixels, the display expects all of them
+        display.beginArea(x0 + x, y0 + y, width, height, 0 == i);
+        for (unsigned int left = width * height; left; n++)
+        {
+            Color *band = m_bands + (n & 1) * VIDEO_BAND_PIXELS;
+            unsigned int count = std::min(left, VIDEO_BAND_PIXELS);
+
+            valid = valid && count == m_decoder.decode(src, srcEnd, m_pixels, count);
+            if (valid)
+            {
+                Sprite part(1, count, c_format, m_pixels);
+                part.blitTo(band, count, 0, 0, 1, count, false);
+            }
+            display.writeArea((const uint32_t *)band, count);
+            left -= count;
+        }
+        display.endArea();
+    }
+
+    if (++m_frame < c_frames)
+    {
+        m_next += _words(frame);
+    }
+    else
+    {
+        m_next = c_first;
+        m_frame = 0;
+    }
+    return valid;
+}
+
+bool Video::play(Display &display)
+{
+    bool valid = true;
+
+    do
+        valid = showFrame(display) && valid;
+    while (0 != m_frame);
+    return valid;
+}
+
+void Video::rewind(void)
+{
+    m_next = c_first;
+    m_frame = 0;
+    m_dueUs = time_us_32();
+}
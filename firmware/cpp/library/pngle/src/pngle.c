@@ -46,6 +46,19 @@
 
 #define PNGLE_UNUSED(x) (void)(x)
 
+// zero bytes ahead of each scanline, the "left" of its first pixel; >= the largest bytes per pixel and keeps scanlines word aligned
+#define PNGLE_SCANLINE_PAD 8
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define PNGLE_LITTLE_ENDIAN 1
+#endif
+
+#ifdef __GNUC__
+#define PNGLE_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define PNGLE_ALWAYS_INLINE inline
+#endif
+
 typedef enum {
 	PNGLE_STATE_ERROR = -2,
 	PNGLE_STATE_EOF = -1,
@@ -89,14 +102,20 @@ struct _pngle_t {
 	mz_ulong crc32;
 
 	// scanline decoder (reset on every set_interlace_pass() call)
-	uint8_t *scanline_ringbuf;
-	size_t scanline_ringbuf_size;
-	size_t scanline_ringbuf_cidx;
-	int_fast8_t scanline_remain_bytes_to_render;
+	uint8_t *scanline_buf; // both scanlines, each behind PNGLE_SCANLINE_PAD zero bytes
+	uint8_t *scanline_cur; // scanline being received
+	uint8_t *scanline_prev; // previous scanline, zeros for the first one of a pass
+	size_t scanline_stride; // bytes of a scanline without the filter type
+	size_t scanline_n; // bytes of the current scanline received so far
 	int_fast8_t filter_type;
 	uint32_t drawing_x;
 	uint32_t drawing_y;
 
+	// row output (reset on every set_interlace_pass() call)
+	uint8_t *row_buf;
+	uint32_t row_n;
+	uint32_t *palette_rgba; // palette and tRNS as RGBA words for the row callback, built on the first indexed scanline
+
 	// interlace
 	uint_fast8_t interlace_pass;
 
@@ -109,6 +128,7 @@ struct _pngle_t {
 	pngle_init_callback_t init_callback;
 	pngle_draw_callback_t draw_callback;
 	pngle_done_callback_t done_callback;
+	pngle_row_callback_t row_callback;
 
 	// misc
 	const char *error;
@@ -159,14 +179,18 @@ void pngle_reset(pngle_t *pngle)
 	pngle->state = PNGLE_STATE_INITIAL;
 	pngle->error = "No error";
 
-	if (pngle->scanline_ringbuf) free(pngle->scanline_ringbuf);
+	if (pngle->scanline_buf) free(pngle->scanline_buf);
+	if (pngle->row_buf) free(pngle->row_buf);
+	if (pngle->palette_rgba) free(pngle->palette_rgba);
 	if (pngle->palette) free(pngle->palette);
 	if (pngle->trans_palette) free(pngle->trans_palette);
 #ifndef PNGLE_NO_GAMMA_CORRECTION
 	if (pngle->gamma_table) free(pngle->gamma_table);
 #endif
 
-	pngle->scanline_ringbuf = NULL;
+	pngle->scanline_buf = NULL;
+	pngle->row_buf = NULL;
+	pngle->palette_rgba = NULL;
 	pngle->palette = NULL;
 	pngle->trans_palette = NULL;
 #ifndef PNGLE_NO_GAMMA_CORRECTION
@@ -238,13 +262,7 @@ static int is_trans_color(pngle_t *pngle, uint16_t *value, size_t n)
 	return 1; // true
 }
 
-static inline void scanline_ringbuf_push(pngle_t *pngle, uint8_t value)
-{
-	pngle->scanline_ringbuf[pngle->scanline_ringbuf_cidx] = value;
-	pngle->scanline_ringbuf_cidx = (pngle->scanline_ringbuf_cidx + 1) % pngle->scanline_ringbuf_size;
-}
-
-static inline uint16_t get_value(pngle_t *pngle, size_t *ridx, int *bitcount, int depth)
+static inline uint16_t get_value(const uint8_t **p, int *bitcount, int depth)
 {
 	uint16_t v;
 
@@ -254,42 +272,120 @@ static inline uint16_t get_value(pngle_t *pngle, size_t *ridx, int *bitcount, in
 	case 4:
 		if (*bitcount >= 8) {
 			*bitcount = 0;
-			*ridx = (*ridx + 1) % pngle->scanline_ringbuf_size;
+			(*p)++;
 		}
 		*bitcount += depth;
 		uint8_t mask = ((1UL << depth) - 1);
 		uint8_t shift = (8 - *bitcount);
-		return (pngle->scanline_ringbuf[*ridx] >> shift) & mask;
+		return (**p >> shift) & mask;
 
 	case 8:
-		v = pngle->scanline_ringbuf[*ridx];
-		*ridx = (*ridx + 1) % pngle->scanline_ringbuf_size;
-		return v;
+		return *(*p)++;
 
 	case 16:
-		v = pngle->scanline_ringbuf[*ridx];
-		*ridx = (*ridx + 1) % pngle->scanline_ringbuf_size;
-
-		v = v * 0x100 + pngle->scanline_ringbuf[*ridx];
-		*ridx = (*ridx + 1) % pngle->scanline_ringbuf_size;
+		v = *(*p)++;
+		v = v * 0x100 + *(*p)++;
 		return v;
 	}
 
 	return 0;
 }
 
-static int pngle_draw_pixels(pngle_t *pngle, size_t scanline_ringbuf_xidx)
+static inline int has_gamma(pngle_t *pngle)
+{
+#ifndef PNGLE_NO_GAMMA_CORRECTION
+	return pngle->gamma_table != NULL;
+#else
+	PNGLE_UNUSED(pngle);
+	return 0;
+#endif
+}
+
+static int build_palette_rgba(pngle_t *pngle)
+{
+	if ((pngle->palette_rgba = PNGLE_CALLOC(256, 4, "palette words")) == NULL) return PNGLE_ERROR("Insufficient memory");
+
+	// indices without palette entry stay 0, the row is checked against n_palettes
+	for (size_t i = 0; i < pngle->n_palettes; i++) {
+		uint32_t alpha = i < pngle->n_trans_palettes ? pngle->trans_palette[i] : 255;
+		const uint8_t *rgb = &pngle->palette[i * 3];
+		pngle->palette_rgba[i] = rgb[0] | (uint32_t)rgb[1] << 8 | (uint32_t)rgb[2] << 16 | alpha << 24;
+	}
+	return 0;
+}
+
+// 8 bit scanlines converted to RGBA without the per pixel path; returns 1 when handled, 0 for the per pixel path, -1 on error
+static int pngle_draw_row_fast(pngle_t *pngle, const uint8_t *row)
+{
+#ifdef PNGLE_LITTLE_ENDIAN
+	uint32_t n = pngle->scanline_stride / pngle->channels;
+	const uint8_t *rgba = pngle->row_buf;
+
+	if (pngle->hdr.depth != 8 || has_gamma(pngle)) return 0;
+
+	switch (pngle->hdr.color_type) {
+	case 6: // RGBA is what the callback takes, hand over the scanline itself
+		rgba = row;
+		break;
+
+	case 2: { // RGB, four pixels from three words
+		if (pngle->n_trans_palettes) return 0;
+
+		const uint32_t *src = (const uint32_t *)row; // scanlines are word aligned
+		uint32_t *dst = (uint32_t *)pngle->row_buf;
+		uint32_t i = 0;
+		for (; i + 4 <= n; i += 4, src += 3) {
+			*dst++ = src[0] | 0xff000000UL;
+			*dst++ = src[0] >> 24 | src[1] << 8 | 0xff000000UL;
+			*dst++ = src[1] >> 16 | src[2] << 16 | 0xff000000UL;
+			*dst++ = src[2] >> 8 | 0xff000000UL;
+		}
+		for (const uint8_t *p = (const uint8_t *)src; i < n; i++, p += 3) {
+			*dst++ = p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | 0xff000000UL;
+		}
+		break;
+	}
+
+	case 3: { // indexed, one table lookup per pixel
+		if (!pngle->palette_rgba && build_palette_rgba(pngle) < 0) return -1;
+
+		uint32_t *dst = (uint32_t *)pngle->row_buf;
+		for (uint32_t i = 0; i < n; i++) {
+			if (row[i] >= pngle->n_palettes) return PNGLE_ERROR("Color index is out of range");
+			dst[i] = pngle->palette_rgba[row[i]];
+		}
+		break;
+	}
+
+	default:
+		return 0;
+	}
+
+	pngle->row_callback(pngle, interlace_off_x[pngle->interlace_pass], pngle->drawing_y, interlace_div_x[pngle->interlace_pass], n, rgba);
+	pngle->drawing_x = pngle->hdr.width;
+	return 1;
+#else
+	PNGLE_UNUSED(pngle);
+	PNGLE_UNUSED(row);
+	return 0;
+#endif
+}
+
+static int pngle_draw_row(pngle_t *pngle, const uint8_t *row)
 {
 	uint16_t v[4]; // MAX_CHANNELS
 	int bitcount = 0;
 	uint8_t pixel_depth = (pngle->hdr.color_type & 1) ? 8 : pngle->hdr.depth;
 	uint16_t maxval = (1UL << pixel_depth) - 1;
 
-	int n_pixels = pngle->hdr.depth == 16 ? 1 : (8 / pngle->hdr.depth);
+	if (pngle->row_callback) {
+		int fast = pngle_draw_row_fast(pngle, row);
+		if (fast) return fast < 0 ? -1 : 0;
+	}
 
-	for (; n_pixels-- > 0 && pngle->drawing_x < pngle->hdr.width; pngle->drawing_x = U32_CLAMP_ADD(pngle->drawing_x, interlace_div_x[pngle->interlace_pass], pngle->hdr.width)) {
+	for (; pngle->drawing_x < pngle->hdr.width; pngle->drawing_x = U32_CLAMP_ADD(pngle->drawing_x, interlace_div_x[pngle->interlace_pass], pngle->hdr.width)) {
 		for (uint_fast8_t c = 0; c < pngle->channels; c++) {
-			v[c] = get_value(pngle, &scanline_ringbuf_xidx, &bitcount, pngle->hdr.depth);
+			v[c] = get_value(&row, &bitcount, pngle->hdr.depth);
 		}
 
 		// color type: 0000 0111
@@ -324,13 +420,21 @@ static int pngle_draw_pixels(pngle_t *pngle, size_t scanline_ringbuf_xidx)
 			v[1] = v[2] = v[0];
 		}
 
-		if (pngle->draw_callback) {
-			uint8_t rgba[4] = {
-				(v[0] * 255 + maxval / 2) / maxval,
-				(v[1] * 255 + maxval / 2) / maxval,
-				(v[2] * 255 + maxval / 2) / maxval,
-				(v[3] * 255 + maxval / 2) / maxval
-			};
+		if (pngle->row_callback || pngle->draw_callback) {
+			uint8_t pixel[4];
+			uint8_t *rgba = pngle->row_callback ? &pngle->row_buf[pngle->row_n++ * 4] : pixel;
+
+			if (maxval == 255) { // no scaling for 8 bit samples and palettes
+				rgba[0] = v[0];
+				rgba[1] = v[1];
+				rgba[2] = v[2];
+				rgba[3] = v[3];
+			} else {
+				rgba[0] = (v[0] * 255 + maxval / 2) / maxval;
+				rgba[1] = (v[1] * 255 + maxval / 2) / maxval;
+				rgba[2] = (v[2] * 255 + maxval / 2) / maxval;
+				rgba[3] = (v[3] * 255 + maxval / 2) / maxval;
+			}
 
 #ifndef PNGLE_NO_GAMMA_CORRECTION
 			if (pngle->gamma_table) {
@@ -340,6 +444,8 @@ static int pngle_draw_pixels(pngle_t *pngle, size_t scanline_ringbuf_xidx)
 			}
 #endif
 
+			if (pngle->row_callback) continue;
+
 			pngle->draw_callback(pngle, pngle->drawing_x, pngle->drawing_y
 				, MIN(interlace_div_x[pngle->interlace_pass] - interlace_off_x[pngle->interlace_pass], pngle->hdr.width  - pngle->drawing_x)
 				, MIN(interlace_div_y[pngle->interlace_pass] - interlace_off_y[pngle->interlace_pass], pngle->hdr.height - pngle->drawing_y)
@@ -348,41 +454,135 @@ static int pngle_draw_pixels(pngle_t *pngle, size_t scanline_ringbuf_xidx)
 		}
 	}
 
+	// hand over the scanline once its last pixel is converted
+	if (pngle->row_callback) {
+		pngle->row_callback(pngle, interlace_off_x[pngle->interlace_pass], pngle->drawing_y, interlace_div_x[pngle->interlace_pass], pngle->row_n, pngle->row_buf);
+		pngle->row_n = 0;
+	}
+
 	return 0;
 }
 
 static inline int paeth(int a, int b, int c)
 {
-	int p = a + b - c;
-	int pa = abs(p - a);
-	int pb = abs(p - b);
-	int pc = abs(p - c);
+	// distances of p = a + b - c without computing p
+	int pa = b - c;
+	int pb = a - c;
+	int pc = abs(pa + pb);
+	pa = abs(pa);
+	pb = abs(pb);
 
 	if (pa <= pb && pa <= pc) return a;
 	if (pb <= pc) return b;
 	return c;
 }
 
+// bytewise a + b and floor((a + b) / 2) of four bytes at once
+static inline uint32_t add_bytes(uint32_t a, uint32_t b)
+{
+	return ((a & 0x7f7f7f7fUL) + (b & 0x7f7f7f7fUL)) ^ ((a ^ b) & 0x80808080UL);
+}
+
+static inline uint32_t avg_bytes(uint32_t a, uint32_t b)
+{
+	return (a & b) + (((a ^ b) & 0xfefefefeUL) >> 1);
+}
+
+// inlined with constant bpp for RGB and RGBA, so the loops are specialized for them
+static PNGLE_ALWAYS_INLINE void unfilter_bytes(uint8_t *cur, const uint8_t *prev, size_t stride, uint_fast8_t bpp, int_fast8_t filter_type)
+{
+	size_t i;
+
+	// cur[-bpp] .. cur[-1] and prev[-bpp] .. prev[-1] are the zero padding
+	switch (filter_type) {
+	case 1: // Sub
+		for (i = 0; i < stride; i += bpp) {
+			for (uint_fast8_t j = 0; j < bpp; j++) cur[i + j] += cur[i + j - bpp];
+		}
+		break;
+	case 3: // Average
+		for (i = 0; i < stride; i += bpp) {
+			for (uint_fast8_t j = 0; j < bpp; j++) cur[i + j] += (cur[i + j - bpp] + prev[i + j]) >> 1;
+		}
+		break;
+	case 4: // Paeth
+		for (i = 0; i < stride; i += bpp) {
+			for (uint_fast8_t j = 0; j < bpp; j++) cur[i + j] += paeth(cur[i + j - bpp], prev[i + j], prev[i + j - bpp]);
+		}
+		break;
+	}
+}
+
+static void unfilter_scanline(pngle_t *pngle, uint_fast8_t bytes_per_pixel)
+{
+	uint8_t *cur = pngle->scanline_cur;
+	const uint8_t *prev = pngle->scanline_prev;
+	size_t stride = pngle->scanline_stride;
+
+	// scanlines are word aligned and padded to whole words, see set_interlace_pass()
+	uint32_t *cur_w = (uint32_t *)cur;
+	const uint32_t *prev_w = (const uint32_t *)prev;
+	size_t words = (stride + 3) / 4;
+
+	switch (pngle->filter_type) {
+	case 0: // None
+		return;
+
+	case 2: // Up, independent of the pixel size
+		for (size_t i = 0; i < words; i++) cur_w[i] = add_bytes(cur_w[i], prev_w[i]);
+		return;
+
+	case 1: // Sub
+		if (bytes_per_pixel == 4) {
+			uint32_t left = 0;
+			for (size_t i = 0; i < words; i++) left = cur_w[i] = add_bytes(cur_w[i], left);
+			return;
+		}
+		break;
+
+	case 3: // Average
+		if (bytes_per_pixel == 4) {
+			uint32_t left = 0;
+			for (size_t i = 0; i < words; i++) left = cur_w[i] = add_bytes(cur_w[i], avg_bytes(left, prev_w[i]));
+			return;
+		}
+		break;
+	}
+
+	if (bytes_per_pixel == 4) unfilter_bytes(cur, prev, stride, 4, pngle->filter_type);
+	else if (bytes_per_pixel == 3) unfilter_bytes(cur, prev, stride, 3, pngle->filter_type);
+	else unfilter_bytes(cur, prev, stride, bytes_per_pixel, pngle->filter_type);
+}
+
 static int set_interlace_pass(pngle_t *pngle, uint_fast8_t pass)
 {
 	pngle->interlace_pass = pass;
 
-	uint_fast8_t bytes_per_pixel = (pngle->channels * pngle->hdr.depth + 7) / 8; // 1 if depth <= 8
 	size_t scanline_pixels = (pngle->hdr.width - interlace_off_x[pngle->interlace_pass] + interlace_div_x[pngle->interlace_pass] - 1) / interlace_div_x[pngle->interlace_pass];
 	size_t scanline_stride = (scanline_pixels * pngle->channels * pngle->hdr.depth + 7) / 8;
 
-	pngle->scanline_ringbuf_size = scanline_stride + bytes_per_pixel * 2; // 2 rooms for c/x and a
+	size_t scanline_room = PNGLE_SCANLINE_PAD + (scanline_stride + 3) / 4 * 4;
+
+	pngle->scanline_stride = scanline_stride;
+	pngle->scanline_n = 0;
 
-	if (pngle->scanline_ringbuf) free(pngle->scanline_ringbuf);
-	if ((pngle->scanline_ringbuf = PNGLE_CALLOC(pngle->scanline_ringbuf_size, 1, "scanline ringbuf")) == NULL) return PNGLE_ERROR("Insufficient memory");
+	// zeroed: padding and the previous scanline of the first one of the pass
+	if (pngle->scanline_buf) free(pngle->scanline_buf);
+	if ((pngle->scanline_buf = PNGLE_CALLOC(scanline_room, 2, "scanlines")) == NULL) return PNGLE_ERROR("Insufficient memory");
+	pngle->scanline_cur = pngle->scanline_buf + PNGLE_SCANLINE_PAD;
+	pngle->scanline_prev = pngle->scanline_buf + scanline_room + PNGLE_SCANLINE_PAD;
+
+	if (pngle->row_buf) free(pngle->row_buf);
+	pngle->row_buf = NULL;
+	pngle->row_n = 0;
+	if (pngle->row_callback && scanline_pixels > 0) {
+		if ((pngle->row_buf = PNGLE_CALLOC(scanline_pixels, 4, "row buffer")) == NULL) return PNGLE_ERROR("Insufficient memory");
+	}
 
 	pngle->drawing_x = interlace_off_x[pngle->interlace_pass];
 	pngle->drawing_y = interlace_off_y[pngle->interlace_pass];
 	pngle->filter_type = -1;
 
-	pngle->scanline_ringbuf_cidx = 0;
-	pngle->scanline_remain_bytes_to_render = -1;
-
 	return 0;
 }
 
@@ -443,45 +643,26 @@ static int pngle_on_data(pngle_t *pngle, const uint8_t *p, int len)
 			}
 
 			pngle->filter_type = (int_fast8_t)*p++; // 0 - 4
-
-			// push sentinel bytes for new line
-			for (uint_fast8_t i = 0; i < bytes_per_pixel; i++) {
-				scanline_ringbuf_push(pngle, 0);
-			}
+			pngle->scanline_n = 0;
 
 			continue;
 		}
 
-		size_t cidx =  pngle->scanline_ringbuf_cidx;
-		size_t bidx = (pngle->scanline_ringbuf_cidx                                + bytes_per_pixel) % pngle->scanline_ringbuf_size;
-		size_t aidx = (pngle->scanline_ringbuf_cidx + pngle->scanline_ringbuf_size - bytes_per_pixel) % pngle->scanline_ringbuf_size;
-		// debug_printf("[pngle] cidx = %zd, bidx = %zd, aidx = %zd\n", cidx, bidx, aidx);
-
-		uint8_t c = pngle->scanline_ringbuf[cidx]; // left-up
-		uint8_t b = pngle->scanline_ringbuf[bidx]; // up
-		uint8_t a = pngle->scanline_ringbuf[aidx]; // left
-		uint8_t x = *p++; // target
-		// debug_printf("[pngle] c = 0x%02x, b = 0x%02x, a = 0x%02x, x = 0x%02x\n", c, b, a, x);
-
-		// Reverse the filter
-		switch (pngle->filter_type) {
-		case 0: break; // None
-		case 1: x += a; break; // Sub
-		case 2: x += b; break; // Up
-		case 3: x += (a + b) / 2; break; // Average
-		case 4: x += paeth(a, b, c); break; // Paeth
-		}
-
-		scanline_ringbuf_push(pngle, x); // updates scanline_ringbuf_cidx
+		// collect the scanline, then reverse the filter and convert it as a whole
+		size_t n = MIN((size_t)(ep - p), pngle->scanline_stride - pngle->scanline_n);
+		memcpy(pngle->scanline_cur + pngle->scanline_n, p, n);
+		p += n;
+		pngle->scanline_n += n;
+		if (pngle->scanline_n < pngle->scanline_stride) continue;
 
-		if (pngle->scanline_remain_bytes_to_render < 0) pngle->scanline_remain_bytes_to_render = bytes_per_pixel;
-		if (--pngle->scanline_remain_bytes_to_render == 0) {
-			size_t xidx = (pngle->scanline_ringbuf_cidx + pngle->scanline_ringbuf_size - bytes_per_pixel) % pngle->scanline_ringbuf_size;
+		unfilter_scanline(pngle, bytes_per_pixel);
 
-			if (pngle_draw_pixels(pngle, xidx) < 0) return -1;
+		if (pngle_draw_row(pngle, pngle->scanline_cur) < 0) return -1;
 
-			pngle->scanline_remain_bytes_to_render = -1; // reset
-		}
+		// the scanline becomes the previous one of the next
+		uint8_t *prev = pngle->scanline_prev;
+		pngle->scanline_prev = pngle->scanline_cur;
+		pngle->scanline_cur = prev;
 	}
 
 	return len;
@@ -854,6 +1035,12 @@ void pngle_set_draw_callback(pngle_t *pngle, pngle_draw_callback_t callback)
 	pngle->draw_callback = callback;
 }
 
+void pngle_set_row_callback(pngle_t *pngle, pngle_row_callback_t callback)
+{
+	if (!pngle) return ;
+	pngle->row_callback = callback;
+}
+
 void pngle_set_done_callback(pngle_t *pngle, pngle_done_callback_t callback)
 {
 	if (!pngle) return ;
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * @file BakeCache.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Cache of procedurally drawn objects baked into sprites
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#include "FrameView.hpp"
+
+#define kBakeCacheBudget (40 * 1024)  ///< Max. SRAM used by baked sprites
+#define kBakeCacheEntries (8)         ///< Max. number of baked sprites
+
+/**
+ * @brief Procedural shapes that can be baked
+ */
+enum class BakeId : uint8_t {
+  kBlackHole,  ///< Rings of the black hole
+  kBumper,     ///< Bumper diamond
+  kBooster,    ///< Booster circles
+  kCoin,       ///< Coin, collected or not
+};
+
+/**
+ * @brief Draws a shape procedurally
+ *
+ * @param fb Framebuffer to draw into
+ * @param x x-position of the shape, as given to BakeCache::Draw()
+ * @param y y-position of the shape, as given to BakeCache::Draw()
+ * @param params Parameters of the shape, e.g. size or state
+ */
+typedef void (*BakeRender_t)(FrameBuffer *fb, int x, int y, uint32_t params);
+
+/**
+ * @brief Description of a shape to bake
+ */
+struct BakeShape_t {
+  BakeId id;            ///< Shape
+  uint32_t params;      ///< Everything that changes the look; part of the key
+  uint16_t width;       ///< Width of the bounding box
+  uint16_t height;      ///< Height of the bounding box
+  int16_t origin_x;     ///< x of the draw position inside the bounding box
+  int16_t origin_y;     ///< y of the draw position inside the bounding box
+  BakeRender_t render;  ///< Procedural drawing of the shape
+};
+
+/**
+ * @class BakeCache
+ * @brief Renders a shape once into a sprite and blits it on later frames.
+ *     Least recently used sprites are dropped to stay within the budget.
+ */
+class BakeCache {
+ private:
+  /**
+   * @brief Baked sprite of one shape and parameter set
+   */
+  struct Entry_t {
+    BakeId id;           ///< Shape
+    uint32_t params;     ///< Parameters the sprite was baked with
+    Sprite *sprite;      ///< Baked image, nullptr when the slot is free
+    uint32_t last_used;  ///< Value of clock_ when used last
+  };
+
+  Entry_t entries_[kBakeCacheEntries];  ///< Baked sprites
+  uint32_t usage_;                      ///< SRAM used by all baked sprites
+  uint32_t clock_;                      ///< Counts lookups, for LRU
+
+  /**
+   * @brief Class constructor
+   */
+  BakeCache();
+
+  /**
+   * @brief Frees least recently used sprites until there is a free slot and
+   *     @p bytes fit into the budget
+   *
+   * @param bytes Size of the sprite to be added
+   *
+   * @return Returns the free slot
+   */
+  Entry_t &Evict(uint32_t bytes);
+
+  /**
+   * @brief Releases the sprite of the given slot
+   *
+   * @param entry Slot to free
+   */
+  void Release(Entry_t &entry);
+
+  /**
+   * @brief Finds the baked sprite of the shape, bakes it on first use
+   *
+   * @param shape Shape to look up
+   *
+   * @return Returns the sprite, nullptr if the shape is larger than the budget
+   */
+  Sprite *Get(const BakeShape_t &shape);
+
+ public:
+  /**
+   * @brief Gets the static instance of the class
+   *
+   * @return Returns a reference to the BakeCache object
+   */
+  static BakeCache &GetInstance();
+
+  /**
+   * @brief Draws the shape from its baked sprite; bakes it on first use.
+   *     Shapes larger than the budget are drawn procedurally.
+   *
+   * @param shape Shape to draw
+   * @param x x-position of the shape
+   * @param y y-position of the shape
+   * @param fb Framebuffer where the shape will be drawn; on a FrameView the
+   *     blit uses the strides known at compile time
+   */
+  template <typename Buffer>
+  void Draw(const BakeShape_t &shape, int x, int y, Buffer *fb) {
+    Sprite *sprite = Get(shape);
+
+    if (sprite == nullptr) {
+      shape.render(fb, x, y, shape.params);
+      return;
+    }
+
+    int x0 = x - shape.origin_x;
+    int y0 = y - shape.origin_y;
+    int cutoffX = (x0 < 0) ? -x0 : 0;
+    int cutoffY = (y0 < 0) ? -y0 : 0;
+
+    if (cutoffX >= shape.width || cutoffY >= shape.height) return;
+
+    fb->blit(x0, y0, cutoffX, cutoffY, shape.width - cutoffX,
+             shape.height - cutoffY, sprite);
+  }
+
+  /**
+   * @brief Drops all baked variants of a shape, e.g. when its look changed
+   *     without a change of its parameters
+   *
+   * @param id Shape to drop
+   */
+  void Invalidate(BakeId id);
+
+  /**
+   * @brief Drops all baked sprites to free the SRAM
+   */
+  void Clear(void);
+
+  /**
+   * @brief SRAM used by baked sprites
+   *
+   * @return Returns the number of bytes
+   */
+  uint32_t GetUsage(void) const { return usage_; }
+};
@@ -37,28 +37,33 @@
 
 #pragma once
 
-#include "FrameView.hpp"
-#include "Object.hpp"
+#include "BakeCache.hpp"
 #include "Physics.hpp"
 
 /**
  * @class BlackHole
- * @brief Class that represents the BlackHole object on the game
+ * @brief Mechanics of the BlackHole objects on the game, the black holes
+ *     themselves are entities of the world
  */
-class BlackHole : public Object {
+class BlackHole {
  private:
   /**
-   * @brief Class constructor
+   * @brief Procedural drawing of the BlackHole, used to bake its sprite
+   *
+   * @param fb Framebuffer where the BlackHole will be drawn
+   * @param x x-position of the BlackHole
+   * @param y y-position of the BlackHole
+   * @param params Unused
    */
-  BlackHole();
+  static void Render(FrameBuffer *fb, int x, int y, uint32_t params);
 
  public:
   /**
-   * @brief Gets the static instance of the class
+   * @brief Shape every BlackHole is drawn with
    *
-   * @return Returns a reference to the BlackHole object
+   * @return Returns the shape, to be drawn at the center of a BlackHole
    */
-  static BlackHole &GetInstance();
+  static const BakeShape_t &GetShape(void);
 
   /**
    * @brief Do the gravity pull between the blackhole and the particle
@@ -67,14 +72,7 @@ class BlackHole : public Object {
    * @param y y-position of the BlackHole
    * @param particle The particle that will suffer the gravity pull effect
    */
-  void GravityPull(int x, int y, Particle &particle);
+  static void GravityPull(int x, int y, Particle &particle);
 
-  /**
-   * @brief Overide Draw method for drawing the BlackHole
-   *
-   * @param x x-position of the BlackHole
-   * @param y y-position of the BlackHole
-   * @param fb FrameView where the BlackHole will be drawn
-   */
-  void Draw(int x, int y, FrameView *fb) override;
+  BlackHole() = delete;
 };
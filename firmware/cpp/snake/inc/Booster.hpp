@@ -38,31 +38,36 @@
 
 #include <cstdint>
 
-#include "Object.hpp"
+#include "BakeCache.hpp"
 #include "Physics.hpp"
 
 /**
  * @class Booster
- * @brief Class that represents the Booster object on the game
+ * @brief Mechanics of the speed-up Booster objects, the boosters themselves
+ *     are entities of the world
  */
-class Booster : public Object {
+class Booster {
  private:
   /**
-   * @brief Class constructor
+   * @brief Procedural drawing of the Booster, used to bake its sprite
+   *
+   * @param fb Framebuffer where the Booster will be drawn
+   * @param x x-position of the Booster
+   * @param y y-position of the Booster
+   * @param params Unused
    */
-  Booster();
+  static void Render(FrameBuffer *fb, int x, int y, uint32_t params);
 
  public:
   /**
-   * @brief Gets the static instance of the class
+   * @brief Shape every Booster is drawn with
    *
-   * @return Returns a reference to the Booster object
+   * @return Returns the shape, to be drawn at the position of a Booster
    */
-  static Booster &GetInstance();
+  static const BakeShape_t &GetShape(void);
 
   /**
    * @brief Checks if the object and the particle collided or not
-   *     Obs.: SetType must be called to set the width and height
    *
    * @param x x-position of the Booster
    * @param y y-position of the Booster
@@ -70,14 +75,7 @@ class Booster : public Object {
    *
    * @return True, if they collided; False otherwise
    */
-  bool CheckCollision(int x, int y, Particle &particle) override;
+  static bool CheckCollision(int x, int y, Particle &particle);
 
-  /**
-   * @brief Specialized drawing method for the coin
-   *
-   * @param x x-position of the Booster
-   * @param y y-position of the Booster
-   * @param fb Framebuffer where the Booster will be drawn
-   */
-  void Draw(int x, int y, FrameView *fb) override;
+  Booster() = delete;
 };
@@ -36,46 +36,46 @@
  *******************************************************************************/
 #pragma once
 
+#include "BakeCache.hpp"
 #include "FrameView.hpp"
-#include "Object.hpp"
 #include "Physics.hpp"
 
 /**
  * @class Bumper
- * @brief Class that represents the Bumper object on the game
+ * @brief Mechanics of the Bumper objects on the game, the bumpers themselves
+ *     are entities of the world
  */
-class Bumper : public Object {
+class Bumper {
  private:
   /**
-   * @brief Bumper constructor
+   * @brief Procedural drawing of the Bumper, used to bake its sprite
+   *
+   * @param fb Framebuffer where the Bumper will be drawn
+   * @param x x-position of the Bumper
+   * @param y y-position of the Bumper
+   * @param params Unused
    */
-  Bumper();
+  static void Render(FrameBuffer *fb, int x, int y, uint32_t params);
 
  public:
   /**
-   * @brief Gets the static instance of the class
+   * @brief Shape every Bumper is drawn with
    *
-   * @return Returns a reference to the Bumper object
+   * @return Returns the shape, to be drawn at the position of a Bumper
    */
-  static Bumper &GetInstance();
+  static const BakeShape_t &GetShape(void);
 
   /**
    * @brief Check if the object and the particle collided or not.
    *     If so, then the particle will be bumped.
-   *     Obs.: SetType must be called to set the width and height
    *
    * @param x x-position of the Bumper
    * @param y y-position of the Bumper
+   * @param particle The particle that will be checked the collision against
    *
    * @return True, if they collided, False otherwise
    */
-  bool CheckCollision(int x, int y, Particle &particle);
+  static bool CheckCollision(int x, int y, Particle &particle);
 
-  /**
-   * @brief Specialized drawing method for the coin
-   *
-   * @param x x-position of the Bumper
-   * @param y y-position of the Bumper
-   */
-  void Draw(int x, int y, FrameView *fb) override;
+  Bumper() = delete;
 };
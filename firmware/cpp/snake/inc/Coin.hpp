@@ -36,60 +36,49 @@
  *******************************************************************************/
 #pragma once
 
-#include <stdbool.h>
-
-#include "FrameView.hpp"
-#include "Object.hpp"
+#include "BakeCache.hpp"
 #include "Physics.hpp"
 
 /**
  * @class Coin
- * @brief Class that represents the Coins/Collectables objects on the game
+ * @brief Mechanics of the Coins/Collectables objects on the game, the coins
+ *     themselves are entities of the world
  */
-class Coin : public Object {
+class Coin {
  private:
   /**
-   * @brief Class constructor
+   * @brief Procedural drawing of the Coin, used to bake its sprite
+   *
+   * @param fb Framebuffer where the Coin will be drawn
+   * @param x x-position of the Coin
+   * @param y y-position of the Coin
+   * @param params Radius in bits 0..7, collected state in bit 8
    */
-  Coin();
-
-  bool
-      collected_;  ///< Stores the information if the coin was collected or not.
-                   // This information is important for the Draw() method that
-                   // uses this information to draw the coin at its normal color
-                   // or at its collected color.
+  static void Render(FrameBuffer *fb, int x, int y, uint32_t params);
 
  public:
   /**
-   * @brief Gets the static instance of the class
+   * @brief Shape of a Coin, a changed size or state is another shape
    *
-   * @return Returns a reference to the Coin object
+   * @param radius Radius of the Coin, its width in the level
+   * @param collected Whether the Coin was collected; it is drawn at its
+   *     normal color or at its collected color
+   *
+   * @return Returns the shape, to be drawn at the center of the Coin
    */
-  static Coin &GetInstance();
+  static BakeShape_t GetShape(int radius, bool collected);
 
   /**
    * @brief Checks if the object and the particle collided or not
-   *     Obs.: SetType must be called to set the width and height
    *
    * @param x x-position of the Coin
    * @param y y-position of the Coin
+   * @param radius Radius of the Coin, its width in the level
    * @param particle The particle that will be checked the collision against
    *
    * @return True, if they collided; False otherwise
    */
-  bool CheckCollision(int x, int y, Particle &particle);
-
-  /**
-   * @brief Specialized drawing method for the coin
-   *
-   * @param x x-position of the Coin
-   * @param y y-position of the Coin
-   * @param fb Framebuffer where the Coin will be drawn
-   */
-  void Draw(int x, int y, FrameView *fb) override;
+  static bool CheckCollision(int x, int y, int radius, Particle &particle);
 
-  /**
-   * @brief Set if the coin was collected or not
-   */
-  void SetCollected(bool collected);
+  Coin() = delete;
 };
@@ -1,5023 +0,0 @@
-// auto-generated file
-#ifndef COORDINATES_H
-#define COORDINATES_H
-
-#include <cstdio>
-
-typedef struct Coordinate_t {
-  int x;             ///< x-coordinate
-  int y;             ///< y-coordinate
-  bool visible;      ///< is the object visible in viewport
-  bool picked;       ///< was the object picked up (if is pickable)
-  uint8_t width;     ///< width of the object
-  uint8_t height;    ///< height of the object
-  int32_t decay;     ///< alpha decay (if have)
-  const char *text;  ///< Text of the object (if have)
-} Coordinate_t;
-
-enum class WorldObjects : int {
-  kBlackHoles = 10,
-  kBumpers = 196,
-  kHeadlines = 3,
-  kBoosters = 14,
-  kCollectables = 367,
-  kPickups = 6,
-  kDecorative_Hexagons = 4,
-  kNubixLogos = 1,
-  k_6EArcades = 1,
-  kCButtons = 1,
-  kDButtons = 1,
-  kFadingTextAreas = 16,
-};
-
-static Coordinate_t BlackHoles[static_cast<int>(WorldObjects::kBlackHoles)] = {
-    {.x = 1150,
-     .y = 8893,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3850,
-     .y = 8174,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3927,
-     .y = 8268,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 4029,
-     .y = 8203,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3928,
-     .y = 8421,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3688,
-     .y = 8211,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 4039,
-     .y = 8357,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1337,
-     .y = 8324,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3690,
-     .y = 8299,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3851,
-     .y = 8422,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 104,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t Bumpers[static_cast<int>(WorldObjects::kBumpers)] = {
-    {.x = 1318,
-     .y = 8897,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1222,
-     .y = 8529,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1208,
-     .y = 8542,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1234,
-     .y = 8517,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1210,
-     .y = 8517,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1222,
-     .y = 8505,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1210,
-     .y = 8494,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1234,
-     .y = 8493,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1221,
-     .y = 8482,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1234,
-     .y = 8469,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1222,
-     .y = 8457,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1208,
-     .y = 8470,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1234,
-     .y = 8445,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1210,
-     .y = 8445,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1222,
-     .y = 8433,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1210,
-     .y = 8422,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1234,
-     .y = 8421,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1260,
-     .y = 8493,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1246,
-     .y = 8506,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1272,
-     .y = 8481,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1247,
-     .y = 8481,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1259,
-     .y = 8469,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1247,
-     .y = 8458,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1272,
-     .y = 8457,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1259,
-     .y = 8446,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1272,
-     .y = 8433,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1260,
-     .y = 8421,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1246,
-     .y = 8434,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1272,
-     .y = 8409,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1247,
-     .y = 8409,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1259,
-     .y = 8397,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1247,
-     .y = 8386,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1272,
-     .y = 8385,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1365,
-     .y = 8501,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1352,
-     .y = 8490,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1365,
-     .y = 8477,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1353,
-     .y = 8464,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1339,
-     .y = 8477,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1439,
-     .y = 8548,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1365,
-     .y = 8453,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1340,
-     .y = 8453,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1426,
-     .y = 8561,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1352,
-     .y = 8441,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1340,
-     .y = 8430,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1452,
-     .y = 8536,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1365,
-     .y = 8429,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1390,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1376,
-     .y = 8513,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1402,
-     .y = 8488,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1378,
-     .y = 8488,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1390,
-     .y = 8477,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1378,
-     .y = 8466,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1402,
-     .y = 8465,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1427,
-     .y = 8536,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1390,
-     .y = 8454,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1401,
-     .y = 8538,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1403,
-     .y = 8441,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1390,
-     .y = 8428,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2907,
-     .y = 8257,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1414,
-     .y = 8525,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3011,
-     .y = 8359,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1376,
-     .y = 8441,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3026,
-     .y = 8344,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1439,
-     .y = 8525,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3009,
-     .y = 8329,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1402,
-     .y = 8416,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1402,
-     .y = 8512,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3041,
-     .y = 8358,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1378,
-     .y = 8416,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3040,
-     .y = 8328,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2798,
-     .y = 8427,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1390,
-     .y = 8405,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2813,
-     .y = 8412,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1388,
-     .y = 8525,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2796,
-     .y = 8397,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1378,
-     .y = 8394,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2828,
-     .y = 8427,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1427,
-     .y = 8514,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2827,
-     .y = 8397,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1402,
-     .y = 8393,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2841,
-     .y = 8412,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1414,
-     .y = 8549,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2857,
-     .y = 8427,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1414,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2856,
-     .y = 8397,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2871,
-     .y = 8412,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1389,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2886,
-     .y = 8427,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1452,
-     .y = 8513,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2885,
-     .y = 8397,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1402,
-     .y = 8489,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3025,
-     .y = 8314,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3008,
-     .y = 8299,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1389,
-     .y = 8478,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3039,
-     .y = 8299,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2890,
-     .y = 8242,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1414,
-     .y = 8477,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2905,
-     .y = 8226,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2888,
-     .y = 8211,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2920,
-     .y = 8241,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2919,
-     .y = 8211,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2903,
-     .y = 8196,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2916,
-     .y = 8531,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2930,
-     .y = 8515,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2914,
-     .y = 8501,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1439,
-     .y = 8502,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2946,
-     .y = 8530,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1452,
-     .y = 8489,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2945,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1439,
-     .y = 8476,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2959,
-     .y = 8515,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1426,
-     .y = 8489,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2974,
-     .y = 8530,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1452,
-     .y = 8464,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2973,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1427,
-     .y = 8464,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2988,
-     .y = 8515,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1439,
-     .y = 8453,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3004,
-     .y = 8530,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1427,
-     .y = 8442,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3003,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1452,
-     .y = 8441,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3019,
-     .y = 8515,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3034,
-     .y = 8530,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3033,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3047,
-     .y = 8515,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3063,
-     .y = 8530,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3062,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3077,
-     .y = 8515,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3092,
-     .y = 8530,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3091,
-     .y = 8500,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3210,
-     .y = 8196,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3225,
-     .y = 8181,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3208,
-     .y = 8166,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3240,
-     .y = 8196,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3239,
-     .y = 8166,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3224,
-     .y = 8151,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3207,
-     .y = 8136,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3238,
-     .y = 8136,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3210,
-     .y = 8257,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3225,
-     .y = 8240,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3209,
-     .y = 8226,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3241,
-     .y = 8255,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3240,
-     .y = 8225,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3224,
-     .y = 8211,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3033,
-     .y = 8168,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3047,
-     .y = 8152,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3031,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3063,
-     .y = 8167,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3062,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3076,
-     .y = 8152,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3091,
-     .y = 8167,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3090,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3105,
-     .y = 8152,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3121,
-     .y = 8167,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3120,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3136,
-     .y = 8152,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3151,
-     .y = 8167,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3150,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3164,
-     .y = 8152,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3180,
-     .y = 8167,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3179,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3194,
-     .y = 8152,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3159,
-     .y = 8374,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3158,
-     .y = 8344,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3174,
-     .y = 8359,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3190,
-     .y = 8374,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3189,
-     .y = 8344,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3203,
-     .y = 8359,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3218,
-     .y = 8374,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3217,
-     .y = 8344,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3232,
-     .y = 8359,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3247,
-     .y = 8374,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3247,
-     .y = 8344,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3025,
-     .y = 8286,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3008,
-     .y = 8272,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3039,
-     .y = 8271,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2888,
-     .y = 8182,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2903,
-     .y = 8166,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2886,
-     .y = 8151,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2918,
-     .y = 8181,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2917,
-     .y = 8151,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2902,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2888,
-     .y = 8182,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2903,
-     .y = 8166,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2886,
-     .y = 8151,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2918,
-     .y = 8181,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2917,
-     .y = 8151,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2902,
-     .y = 8137,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1197,
-     .y = 8529,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1438,
-     .y = 8571,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1453,
-     .y = 8592,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1197,
-     .y = 8505,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1196,
-     .y = 8481,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1197,
-     .y = 8456,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1197,
-     .y = 8433,
-     .visible = 0,
-     .picked = 0,
-     .width = 18,
-     .height = 18,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t Headlines[static_cast<int>(WorldObjects::kHeadlines)] = {
-    {.x = 1965,
-     .y = 8254,
-     .visible = 0,
-     .picked = 0,
-     .width = 0,
-     .height = 0,
-     .decay = 0,
-     .text = "Idee"},
-    {.x = 2612,
-     .y = 8227,
-     .visible = 0,
-     .picked = 0,
-     .width = 0,
-     .height = 0,
-     .decay = 0,
-     .text = "Hardware"},
-    {.x = 3361,
-     .y = 8243,
-     .visible = 0,
-     .picked = 0,
-     .width = 0,
-     .height = 0,
-     .decay = 0,
-     .text = "Software"}};
-
-static Coordinate_t Boosters[static_cast<int>(WorldObjects::kBoosters)] = {
-    {.x = 1880,
-     .y = 8305,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2585,
-     .y = 8219,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2372,
-     .y = 8325,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2181,
-     .y = 8371,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2165,
-     .y = 8278,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2068,
-     .y = 8207,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2178,
-     .y = 8124,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2288,
-     .y = 8250,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2365,
-     .y = 8150,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2372,
-     .y = 8441,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2229,
-     .y = 8481,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 2454,
-     .y = 8377,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3341,
-     .y = 8291,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL},
-    {.x = 1291,
-     .y = 8602,
-     .visible = 0,
-     .picked = 0,
-     .width = 19,
-     .height = 19,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t Collectables[static_cast<int>(
-    WorldObjects::kCollectables)] = {{.x = 1252,
-                                      .y = 8839,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1251,
-                                      .y = 8821,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1250,
-                                      .y = 8798,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1243,
-                                      .y = 8779,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1233,
-                                      .y = 8763,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1220,
-                                      .y = 8747,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1212,
-                                      .y = 8730,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1210,
-                                      .y = 8714,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1217,
-                                      .y = 8694,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1228,
-                                      .y = 8682,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1243,
-                                      .y = 8674,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1260,
-                                      .y = 8669,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1277,
-                                      .y = 8661,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1286,
-                                      .y = 8644,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1290,
-                                      .y = 8625,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1306,
-                                      .y = 8316,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1313,
-                                      .y = 8304,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1324,
-                                      .y = 8296,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1337,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1350,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1363,
-                                      .y = 8292,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1376,
-                                      .y = 8289,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1386,
-                                      .y = 8284,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1399,
-                                      .y = 8277,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1412,
-                                      .y = 8273,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1424,
-                                      .y = 8271,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1438,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1453,
-                                      .y = 8271,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1466,
-                                      .y = 8273,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1481,
-                                      .y = 8273,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1494,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1507,
-                                      .y = 8267,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1520,
-                                      .y = 8265,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1533,
-                                      .y = 8267,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1544,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1556,
-                                      .y = 8275,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1569,
-                                      .y = 8281,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1584,
-                                      .y = 8283,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1593,
-                                      .y = 8279,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1605,
-                                      .y = 8275,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1616,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1628,
-                                      .y = 8267,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1766,
-                                      .y = 8308,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1774,
-                                      .y = 8313,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1787,
-                                      .y = 8315,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1798,
-                                      .y = 8316,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1811,
-                                      .y = 8316,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1824,
-                                      .y = 8314,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1836,
-                                      .y = 8311,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1848,
-                                      .y = 8308,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1859,
-                                      .y = 8307,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1640,
-                                      .y = 8265,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1650,
-                                      .y = 8264,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1662,
-                                      .y = 8265,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1673,
-                                      .y = 8267,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1684,
-                                      .y = 8268,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1693,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1703,
-                                      .y = 8271,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1715,
-                                      .y = 8269,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1725,
-                                      .y = 8268,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1735,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1743,
-                                      .y = 8276,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1752,
-                                      .y = 8284,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1757,
-                                      .y = 8291,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1760,
-                                      .y = 8300,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2187,
-                                      .y = 8271,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2230,
-                                      .y = 8263,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2251,
-                                      .y = 8260,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2088,
-                                      .y = 8188,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2110,
-                                      .y = 8172,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2131,
-                                      .y = 8159,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2155,
-                                      .y = 8144,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2304,
-                                      .y = 8227,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2317,
-                                      .y = 8210,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2332,
-                                      .y = 8193,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2348,
-                                      .y = 8172,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2201,
-                                      .y = 8123,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2224,
-                                      .y = 8123,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2177,
-                                      .y = 8344,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2172,
-                                      .y = 8322,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2170,
-                                      .y = 8300,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2200,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2217,
-                                      .y = 8332,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2233,
-                                      .y = 8316,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2248,
-                                      .y = 8299,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2261,
-                                      .y = 8284,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2389,
-                                      .y = 8431,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2402,
-                                      .y = 8420,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2416,
-                                      .y = 8409,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2427,
-                                      .y = 8399,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2427,
-                                      .y = 8399,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2191,
-                                      .y = 8398,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2202,
-                                      .y = 8416,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2211,
-                                      .y = 8440,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2220,
-                                      .y = 8458,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2257,
-                                      .y = 8474,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2283,
-                                      .y = 8465,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2309,
-                                      .y = 8458,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2328,
-                                      .y = 8454,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2350,
-                                      .y = 8447,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2274,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2541,
-                                      .y = 8221,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2541,
-                                      .y = 8221,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2556,
-                                      .y = 8221,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2556,
-                                      .y = 8221,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2773,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2773,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2793,
-                                      .y = 8283,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2793,
-                                      .y = 8283,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2815,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2815,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2839,
-                                      .y = 8303,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2839,
-                                      .y = 8303,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2862,
-                                      .y = 8306,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2940,
-                                      .y = 8278,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2940,
-                                      .y = 8278,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2954,
-                                      .y = 8258,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2954,
-                                      .y = 8258,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2969,
-                                      .y = 8238,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2969,
-                                      .y = 8238,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2988,
-                                      .y = 8223,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2988,
-                                      .y = 8223,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3013,
-                                      .y = 8214,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3013,
-                                      .y = 8214,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3036,
-                                      .y = 8209,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3036,
-                                      .y = 8209,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3057,
-                                      .y = 8209,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3057,
-                                      .y = 8209,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3079,
-                                      .y = 8209,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3079,
-                                      .y = 8209,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3105,
-                                      .y = 8208,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3105,
-                                      .y = 8208,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2921,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2921,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2933,
-                                      .y = 8362,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2949,
-                                      .y = 8377,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2949,
-                                      .y = 8377,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2970,
-                                      .y = 8394,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2970,
-                                      .y = 8394,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2989,
-                                      .y = 8408,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2989,
-                                      .y = 8408,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3057,
-                                      .y = 8398,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3072,
-                                      .y = 8379,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3072,
-                                      .y = 8379,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3086,
-                                      .y = 8355,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3086,
-                                      .y = 8355,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3099,
-                                      .y = 8332,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3113,
-                                      .y = 8312,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3127,
-                                      .y = 8295,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3057,
-                                      .y = 8398,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3150,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3150,
-                                      .y = 8270,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3155,
-                                      .y = 8242,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3155,
-                                      .y = 8242,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3159,
-                                      .y = 8295,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3159,
-                                      .y = 8295,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3188,
-                                      .y = 8295,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3188,
-                                      .y = 8295,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3896,
-                                      .y = 8195,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3912,
-                                      .y = 8200,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2862,
-                                      .y = 8310,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3879,
-                                      .y = 8198,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3865,
-                                      .y = 8206,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3839,
-                                      .y = 8208,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3839,
-                                      .y = 8208,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3824,
-                                      .y = 8200,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3813,
-                                      .y = 8192,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3803,
-                                      .y = 8187,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3788,
-                                      .y = 8182,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3788,
-                                      .y = 8182,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3767,
-                                      .y = 8179,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3767,
-                                      .y = 8179,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3744,
-                                      .y = 8183,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3744,
-                                      .y = 8183,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3723,
-                                      .y = 8184,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3723,
-                                      .y = 8184,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3700,
-                                      .y = 8175,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3700,
-                                      .y = 8175,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3673,
-                                      .y = 8178,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3673,
-                                      .y = 8178,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3656,
-                                      .y = 8193,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3656,
-                                      .y = 8193,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3652,
-                                      .y = 8219,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3652,
-                                      .y = 8219,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3663,
-                                      .y = 8235,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3663,
-                                      .y = 8235,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3677,
-                                      .y = 8244,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3677,
-                                      .y = 8244,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3695,
-                                      .y = 8256,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3714,
-                                      .y = 8266,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3724,
-                                      .y = 8281,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3824,
-                                      .y = 8200,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3728,
-                                      .y = 8302,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3718,
-                                      .y = 8321,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4051,
-                                      .y = 8165,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4038,
-                                      .y = 8159,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4072,
-                                      .y = 8197,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4071,
-                                      .y = 8209,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4068,
-                                      .y = 8222,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4048,
-                                      .y = 8242,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4039,
-                                      .y = 8252,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4035,
-                                      .y = 8268,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4035,
-                                      .y = 8268,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4037,
-                                      .y = 8285,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4037,
-                                      .y = 8285,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4046,
-                                      .y = 8300,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4057,
-                                      .y = 8313,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4068,
-                                      .y = 8323,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4077,
-                                      .y = 8334,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4082,
-                                      .y = 8346,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4083,
-                                      .y = 8359,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4040,
-                                      .y = 8401,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4027,
-                                      .y = 8399,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4012,
-                                      .y = 8391,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3999,
-                                      .y = 8376,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3989,
-                                      .y = 8361,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3712,
-                                      .y = 8343,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3712,
-                                      .y = 8343,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3712,
-                                      .y = 8364,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3712,
-                                      .y = 8364,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2322,
-                                      .y = 8238,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2340,
-                                      .y = 8237,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2355,
-                                      .y = 8234,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2340,
-                                      .y = 8237,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2370,
-                                      .y = 8232,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2384,
-                                      .y = 8231,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2400,
-                                      .y = 8230,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2417,
-                                      .y = 8228,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2436,
-                                      .y = 8227,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2454,
-                                      .y = 8225,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2471,
-                                      .y = 8225,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2505,
-                                      .y = 8222,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2488,
-                                      .y = 8223,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2525,
-                                      .y = 8222,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3217,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3217,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3245,
-                                      .y = 8292,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3245,
-                                      .y = 8292,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3269,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3269,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3299,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3299,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3323,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3323,
-                                      .y = 8293,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 1305,
-                                      .y = 8333,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2246,
-                                      .y = 8127,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2264,
-                                      .y = 8129,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2281,
-                                      .y = 8133,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2298,
-                                      .y = 8135,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2317,
-                                      .y = 8138,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2335,
-                                      .y = 8142,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2095,
-                                      .y = 8211,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2121,
-                                      .y = 8215,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2257,
-                                      .y = 8242,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2230,
-                                      .y = 8235,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2202,
-                                      .y = 8230,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2174,
-                                      .y = 8224,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2147,
-                                      .y = 8218,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2207,
-                                      .y = 8267,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2305,
-                                      .y = 8263,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2316,
-                                      .y = 8273,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2328,
-                                      .y = 8282,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2338,
-                                      .y = 8292,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2348,
-                                      .y = 8301,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2373,
-                                      .y = 8421,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2358,
-                                      .y = 8311,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2373,
-                                      .y = 8404,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2373,
-                                      .y = 8387,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2374,
-                                      .y = 8372,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2374,
-                                      .y = 8357,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2373,
-                                      .y = 8342,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2389,
-                                      .y = 8338,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2402,
-                                      .y = 8345,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2413,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2426,
-                                      .y = 8360,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2438,
-                                      .y = 8368,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2440,
-                                      .y = 8389,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 2440,
-                                      .y = 8389,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3719,
-                                      .y = 8382,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3719,
-                                      .y = 8382,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3734,
-                                      .y = 8393,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3734,
-                                      .y = 8393,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3753,
-                                      .y = 8397,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3753,
-                                      .y = 8397,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3769,
-                                      .y = 8392,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3769,
-                                      .y = 8392,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3781,
-                                      .y = 8382,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3781,
-                                      .y = 8382,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3792,
-                                      .y = 8371,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3792,
-                                      .y = 8371,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3805,
-                                      .y = 8361,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3805,
-                                      .y = 8361,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3818,
-                                      .y = 8355,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3818,
-                                      .y = 8355,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3833,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3833,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3849,
-                                      .y = 8351,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3849,
-                                      .y = 8351,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3866,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3866,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3879,
-                                      .y = 8357,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3879,
-                                      .y = 8357,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3893,
-                                      .y = 8359,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3893,
-                                      .y = 8359,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3907,
-                                      .y = 8357,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3907,
-                                      .y = 8357,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3907,
-                                      .y = 8357,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3907,
-                                      .y = 8357,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3921,
-                                      .y = 8352,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3934,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3948,
-                                      .y = 8347,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3930,
-                                      .y = 8206,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3961,
-                                      .y = 8348,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3975,
-                                      .y = 8353,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4066,
-                                      .y = 8392,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4053,
-                                      .y = 8399,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4074,
-                                      .y = 8383,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4081,
-                                      .y = 8371,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4060,
-                                      .y = 8233,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4069,
-                                      .y = 8185,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4062,
-                                      .y = 8174,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4024,
-                                      .y = 8159,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4011,
-                                      .y = 8163,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 4000,
-                                      .y = 8170,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3992,
-                                      .y = 8179,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3987,
-                                      .y = 8189,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3981,
-                                      .y = 8200,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3973,
-                                      .y = 8208,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3962,
-                                      .y = 8211,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3950,
-                                      .y = 8211,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3939,
-                                      .y = 8210,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL},
-                                     {.x = 3853,
-                                      .y = 8210,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 4,
-                                      .height = 4,
-                                      .decay = 0,
-                                      .text = NULL}};
-
-static Coordinate_t Pickups[static_cast<int>(WorldObjects::kPickups)] = {
-    {.x = 2908,
-     .y = 8319,
-     .visible = 0,
-     .picked = 0,
-     .width = 64,
-     .height = 64,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3025,
-     .y = 8435,
-     .visible = 0,
-     .picked = 0,
-     .width = 64,
-     .height = 64,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3144,
-     .y = 8213,
-     .visible = 0,
-     .picked = 0,
-     .width = 64,
-     .height = 64,
-     .decay = 0,
-     .text = NULL},
-    {.x = 3283,
-     .y = 8420,
-     .visible = 0,
-     .picked = 0,
-     .width = 64,
-     .height = 64,
-     .decay = 0,
-     .text = NULL},
-    {.x = 4085,
-     .y = 8273,
-     .visible = 0,
-     .picked = 0,
-     .width = 64,
-     .height = 64,
-     .decay = 0,
-     .text = NULL},
-    {.x = 4217,
-     .y = 8280,
-     .visible = 0,
-     .picked = 0,
-     .width = 64,
-     .height = 64,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t Decorative_Hexagons[static_cast<int>(
-    WorldObjects::kDecorative_Hexagons)] = {{.x = 2603,
-                                             .y = 8273,
-                                             .visible = 0,
-                                             .picked = 0,
-                                             .width = 45,
-                                             .height = 39,
-                                             .decay = 0,
-                                             .text = NULL},
-                                            {.x = 2643,
-                                             .y = 8296,
-                                             .visible = 0,
-                                             .picked = 0,
-                                             .width = 45,
-                                             .height = 39,
-                                             .decay = 0,
-                                             .text = NULL},
-                                            {.x = 3456,
-                                             .y = 8314,
-                                             .visible = 0,
-                                             .picked = 0,
-                                             .width = 45,
-                                             .height = 39,
-                                             .decay = 0,
-                                             .text = NULL},
-                                            {.x = 3493,
-                                             .y = 8290,
-                                             .visible = 0,
-                                             .picked = 0,
-                                             .width = 45,
-                                             .height = 39,
-                                             .decay = 0,
-                                             .text = NULL}};
-
-static Coordinate_t NubixLogos[static_cast<int>(WorldObjects::kNubixLogos)] = {
-    {.x = 1219,
-     .y = 8683,
-     .visible = 0,
-     .picked = 0,
-     .width = 138,
-     .height = 65,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t _6EArcades[static_cast<int>(WorldObjects::k_6EArcades)] = {
-    {.x = 1265,
-     .y = 8896,
-     .visible = 0,
-     .picked = 0,
-     .width = 104,
-     .height = 63,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t CButtons[static_cast<int>(WorldObjects::kCButtons)] = {
-    {.x = 1174,
-     .y = 8988,
-     .visible = 0,
-     .picked = 0,
-     .width = 51,
-     .height = 63,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t DButtons[static_cast<int>(WorldObjects::kDButtons)] = {
-    {.x = 1302,
-     .y = 8987,
-     .visible = 0,
-     .picked = 0,
-     .width = 51,
-     .height = 63,
-     .decay = 0,
-     .text = NULL}};
-
-static Coordinate_t
-    FadingTextAreas[static_cast<int>(WorldObjects::kFadingTextAreas)] = {
-        {.x = 1474,
-         .y = 8281,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Das ist die\nGeschichte..."},
-        {.x = 1635,
-         .y = 8276,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "...von einer Idee..."},
-        {.x = 1809,
-         .y = 8285,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "...zum fertigen\nProdukt"},
-        {.x = 2110,
-         .y = 8291,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Maximale Effizienz..."},
-        {.x = 2935,
-         .y = 8310,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "...dennoch standard\n-konform."},
-        {.x = 3069,
-         .y = 8310,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Fertigung:1.Entwurf\ndirekt erfolgreich"},
-        {.x = 3276,
-         .y = 8307,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Flashen durch\nMuenzeinwurf"},
-        {.x = 2246,
-         .y = 8290,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "bei minimalen\nProduktionskosten"},
-        {.x = 2373,
-         .y = 8289,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Kleine Platine..."},
-        {.x = 2501,
-         .y = 8290,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "...vereint verschie-\ndene Disziplinen."},
-        {.x = 2797,
-         .y = 8311,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Im Fokus: einfaches\nDesign..."},
-        {.x = 3625,
-         .y = 8318,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Auch hier im Fokus:\nEffizienz..."},
-        {.x = 3781,
-         .y = 8306,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "...und Performance!"},
-        {.x = 3918,
-         .y = 8305,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Optimale Nutzung\nder Mittel..."},
-        {.x = 4068,
-         .y = 8300,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "...denn jedes Byte\nist es wert!"},
-        {.x = 3172,
-         .y = 8309,
-         .visible = 0,
-         .picked = 0,
-         .width = 10,
-         .height = 10,
-         .decay = 0,
-         .text = "Highlight:\nIntegrierter Sensor"}};
-
-#define MIN_X (1150 - 90)
-#define MIN_Y (8123 - 90)
-#define MAX_X (4217 + 90)
-#define MAX_Y (8988 + 160)
-
-#endif /* COORDINATES_H */
@@ -36,10 +36,13 @@
  *******************************************************************************/
 #pragma once
 
+#include <common/AssetPack.hpp>
 #include <cstdint>
 
 #include "FrameView.hpp"
 
+#define kDILBudget (16 * 1024)  ///< Max. SRAM used by loaded sprites
+
 /**
  * @brief Enumeration of the sprites currently supported by the firmware
  */
@@ -70,12 +73,34 @@ enum class DILIndex : int {
   kNumDIL,
 };
 
+/**
+ * @brief Enumeration of the fonts in the asset pack
+ */
+enum class DILFont : int {
+  kAzaretSmall = 0,  ///< Azaret font, 13 px high
+  kAzaretLarge,      ///< Azaret font, 20 px high
+  kNumFonts,
+};
+
 /**
  * @brief Structure to store the Sprite information
  */
 struct Sprites_t {
-  const uint32_t* data;  ///< Data of the sprite used to draw
-  uint32_t size;         ///< Size of the sprite's data
+  const uint32_t* data;    ///< Compiled sprite blob, see Sprite::load()
+  uint32_t size;           ///< Size of the sprite blob
+  const SpriteRect* rect;  ///< Area inside the atlas blob, nullptr if the
+                           ///< blob holds this sprite only
+};
+
+/**
+ * @brief Statistics of the sprite cache of the DIL
+ */
+struct DILStats_t {
+  uint32_t hits;        ///< GetSprite() calls served by a loaded sprite
+  uint32_t misses;      ///< GetSprite() calls that loaded the sprite
+  uint32_t evictions;   ///< Sprites released to stay within kDILBudget
+  uint32_t prefetches;  ///< Sprites loaded by Prefetch() before drawing
+  uint32_t usage;       ///< SRAM used by the loaded sprites
 };
 
 /**
@@ -85,14 +110,71 @@ class DIL {
  private:
   Sprites_t sprites_[static_cast<int>(
       DILIndex::kNumDIL)];  ///< Stores the sprites information
-  FrameView* frameBuffers_[static_cast<int>(
-      DILIndex::kNumDIL)];  ///< Temporary framebuffers used by loaded sprites
-  int callers_[static_cast<int>(
-      DILIndex::kNumDIL)];  ///< To store how many callers for a particular
-                            ///< sprite will exist
-  int current_[static_cast<int>(
-      DILIndex::kNumDIL)];  ///< How many callers are currently using this
-                            ///< sprite
+  Sprite* surfaces_[static_cast<int>(
+      DILIndex::kNumDIL)];  ///< Decoded surfaces of the loaded sprites
+  uint32_t sizes_[static_cast<int>(
+      DILIndex::kNumDIL)];  ///< SRAM used by each loaded sprite
+  uint32_t last_used_[static_cast<int>(
+      DILIndex::kNumDIL)];  ///< Value of clock_ when used last
+  bool pinned_[static_cast<int>(
+      DILIndex::kNumDIL)];  ///< Pinned sprites are never evicted
+  Font* fonts_[static_cast<int>(
+      DILFont::kNumFonts)];  ///< Fonts of the asset pack, nullptr if missing
+  const AssetPack* pack_;    ///< Assets of the game, nullptr if invalid
+  Sprite* atlas_;     ///< Loaded world atlas, shared by its sprites
+  int atlas_users_;   ///< How many loaded sprites are views into atlas_
+  uint32_t clock_;    ///< Counts lookups, for LRU
+  DILStats_t stats_;  ///< Cache statistics
+
+  /**
+   * @brief Loads the atlas of the given sprite, once for all its sprites
+   *
+   * @param sprite Sprite inside the atlas
+   *
+   * @return Returns the atlas, nullptr if it is not loadable
+   */
+  Sprite* AcquireAtlas(const Sprites_t& sprite);
+
+  /**
+   * @brief Releases the atlas when its last sprite is released
+   */
+  void ReleaseAtlas(void);
+
+  /**
+   * @brief SRAM a sprite will use once loaded, read from its blob header
+   *     Raw blobs and atlas views stay in flash, only the Sprite object is
+   *     allocated.
+   *
+   * @param sprite Sprite to be loaded
+   *
+   * @return Returns the number of bytes
+   */
+  static uint32_t Cost(const Sprites_t& sprite);
+
+  /**
+   * @brief Releases least recently used sprites, which are not pinned,
+   *     until @p bytes fit into the budget
+   *
+   * @param bytes Size of the sprite to be loaded
+   */
+  void Evict(uint32_t bytes);
+
+  /**
+   * @brief Releases the loaded sprite at the given index
+   *
+   * @param i Index of the sprite
+   */
+  void Release(int i);
+
+  /**
+   * @brief Loads the sprite at the given index into its empty slot
+   *
+   * @param i Index of the sprite
+   * @param bytes SRAM the sprite uses, see Cost()
+   *
+   * @return Returns the loaded sprite, nullptr if it is not loadable
+   */
+  Sprite* Load(int i, uint32_t bytes);
 
   /**
    * @brief Class constructor
@@ -117,31 +199,72 @@ class DIL {
   void GetSprite(DILIndex index, FrameView& fb);
 
   /**
-   * @brief Loads the given sprite into the local framebuffer cache
-   *     Obs.: After using it, must call the ReleaseSprite() method
-   *     to release the memory
+   * @brief Show a fullscreen sprite directly on the display
+   *     The image is decoded band by band while the previous band is
+   *     transferred, so neither the frame buffer nor a decoded copy of the
+   *     image is needed. The frame buffer must not be shown meanwhile.
+   *
+   * @param index Index of the sprite to be shown
+   *
+   * @return Returns false if the sprite can not be streamed, then use
+   *     GetSprite(index, fb) instead
+   */
+  bool ShowSprite(DILIndex index);
+
+  /**
+   * @brief Loads the given sprite into the sprite cache
+   *     The sprite stays loaded until it is evicted by other sprites exceeding
+   *     kDILBudget, so the pointer is valid until the next call of
+   *     GetSprite() or a Release method.
    *
    * @param index Index of the sprite to be loaded
    *
-   * @return Returns a pointer to the loaded framebuffer
+   * @return Returns a pointer to the loaded sprite, nullptr for sprites
+   *     without image
+   */
+  Sprite* GetSprite(DILIndex index);
+
+  /**
+   * @brief Loads the given sprite ahead of drawing it, e.g. when it is about
+   *     to enter the viewport. Safe to call from the other core than the
+   *     one drawing; nothing is evicted, the sprite is skipped when it does
+   *     not fit into the free budget.
+   *
+   * @param index Index of the sprite to be loaded
    */
-  FrameView* GetSprite(DILIndex index);
+  void Prefetch(DILIndex index);
 
   /**
-   * @brief Release the given sprite framebuffer
+   * @brief Release the given sprite, even if it is pinned
    *
    * @param index Index of the sprite to be released
    */
   void ReleaseSprite(DILIndex index);
 
   /**
-   * @brief Release the given sprite framebuffer forced
-   *     That means, it will release the sprite irrespective of the
-   *     number of callers set for this sprite
+   * @brief Keep the given sprite loaded once it was loaded, e.g. sprites
+   *     drawn on every frame, so neither a miss nor ReleaseAll() evicts it
    *
-   * @param index Index of the sprite to be released
+   * @param index Index of the sprite
+   * @param pinned true to never evict the sprite, false to allow it again
+   */
+  void Pin(DILIndex index, bool pinned);
+
+  /**
+   * @brief Gets a font of the asset pack
+   *
+   * @param font Index of the font
+   *
+   * @return Returns the font, it draws nothing if it is missing in the pack
+   */
+  const Font& GetFont(DILFont font) const;
+
+  /**
+   * @brief Gets the asset pack of the game, e.g. to find other assets
+   *
+   * @return Returns the pack, nullptr if it is invalid
    */
-  void ReleaseSpriteForced(DILIndex index);
+  const AssetPack* GetAssets(void) const { return pack_; }
 
   /**
    * @brief Gets the full screen image index based on the provided @p index
@@ -156,21 +279,15 @@ class DIL {
   static DILIndex GetFullScreenIndex(DILIndex index);
 
   /**
-   * @brief Set how many callers will be possibly using this sprite
-   *        This information is neede to manage how we load the sprite
-   *        and when we should release the sprite, to avoid keeping
-   *        non-used sprites in SRAM memory.
-   *        This function has relationship with the World.cpp class,
-   *        which indicates how many objects of the same kind there will
-   *        exist. So, based on that value the decision is taken.
-   *
-   * @param index Which sprite we are setting the number of callers
-   * @param callers How many callers for this particular sprite
+   * @brief Releases all the loaded sprites which are not pinned and the idle
+   *     PNG decoders, e.g. to free the SRAM for a fullscreen image
    */
-  void SetNumberOfCallers(DILIndex index, int callers);
+  void ReleaseAll(void);
 
   /**
-   * @brief Releases all the loaded sprites in the local framebuffer cache
+   * @brief Statistics of the sprite cache
+   *
+   * @return Returns the counters since start-up and the current usage
    */
-  void ReleaseAll(void);
+  const DILStats_t& GetStats(void) const { return stats_; }
 };
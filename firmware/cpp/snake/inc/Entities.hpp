@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * @file Entities.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Store of the world objects and the systems working on them
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include "BakeCache.hpp"
+#include "DynamicImageLoader.hpp"
+#include "FrameView.hpp"
+#include "Level.hpp"
+#include "SpatialGrid.hpp"
+#include "Viewport.hpp"
+
+/**
+ * @brief Box of an entity relative to its position, e.g. of a baked shape
+ */
+struct EntityBox_t {
+  int x;       ///< Left of the box relative to the x of the entity
+  int y;       ///< Top of the box relative to the y of the entity
+  int width;   ///< Width of the box
+  int height;  ///< Height of the box
+};
+
+/**
+ * @class Entities
+ * @brief Objects of the world, one entity per object of the level. The
+ *     components (position and extent) are arrays per kind, read in place
+ *     from the level; the state changing while playing is kept by the world.
+ *     The systems below go over these arrays a kind at a time, so no object
+ *     of the game has to be mutated into the kind it is drawn as.
+ */
+class Entities {
+ private:
+  LevelObjects_t objects_[static_cast<int>(
+      LevelObject::kNumObjects)];  ///< Components of each kind
+  SpatialGrid grids_[static_cast<int>(
+      LevelObject::kNumObjects)];  ///< Index of each kind
+
+ public:
+  /**
+   * @brief Class constructor, without entities
+   */
+  Entities();
+
+  /**
+   * @brief Uses the objects of the given level, replacing the previous ones
+   *
+   * @param level Level to be used, must stay loaded
+   */
+  void Load(const Level &level);
+
+  /**
+   * @brief Components of the given kind
+   *
+   * @param kind Kind of the entities
+   *
+   * @return Returns the arrays, indexed by entity
+   */
+  const LevelObjects_t &Get(LevelObject kind) const {
+    return objects_[static_cast<int>(kind)];
+  }
+
+  /**
+   * @brief Whether the box of an object intersects the viewport
+   *
+   * @param vp Viewport to be checked
+   * @param x Left of the box
+   * @param y Top of the box
+   * @param width Width of the box
+   * @param height Height of the box
+   *
+   * @return True, if the box is visible; False otherwise
+   */
+  static bool IsVisible(const Viewport &vp, int x, int y, int width,
+                        int height) {
+    return (x < vp.GetX() + vp.GetWidth()) & (x + width > vp.GetX()) &
+           (y < vp.GetY() + vp.GetHeight()) & (y + height > vp.GetY());
+  }
+
+  /**
+   * @brief Culling, visits the entities of a kind whose extent intersects
+   *     the given area
+   *
+   * @param kind Kind of the entities
+   * @param x Left of the area
+   * @param y Top of the area
+   * @param width Width of the area
+   * @param height Height of the area
+   * @param visit Called with the index of each entity
+   */
+  template <typename Visit>
+  void ForEachInArea(LevelObject kind, int x, int y, int width, int height,
+                     Visit visit) const {
+    const LevelObjects_t &objects = Get(kind);
+    int x_max = x + width;
+    int y_max = y + height;
+
+    grids_[static_cast<int>(kind)].ForEachInArea(
+        x, y, width, height, [&](int i) {
+          if ((objects.x[i] < x_max) & (objects.x[i] + objects.width[i] > x) &
+              (objects.y[i] < y_max) & (objects.y[i] + objects.height[i] > y))
+            visit(i);
+        });
+  }
+
+  /**
+   * @brief Culling of entities drawn with the same box, e.g. a baked shape
+   *     around their position, instead of their extent
+   *
+   * @param kind Kind of the entities
+   * @param box Box of every entity
+   * @param x Left of the area
+   * @param y Top of the area
+   * @param width Width of the area
+   * @param height Height of the area
+   * @param visit Called with the index of each entity
+   */
+  template <typename Visit>
+  void ForEachInArea(LevelObject kind, const EntityBox_t &box, int x, int y,
+                     int width, int height, Visit visit) const {
+    const LevelObjects_t &objects = Get(kind);
+
+    /* positions of the boxes intersecting the area */
+    int x_min = x - box.x - box.width;
+    int y_min = y - box.y - box.height;
+    int x_max = x + width - box.x;
+    int y_max = y + height - box.y;
+
+    grids_[static_cast<int>(kind)].ForEach(
+        x_min + 1, y_min + 1, x_max - 1, y_max - 1, [&](int i) {
+          if ((objects.x[i] > x_min) & (objects.x[i] < x_max) &
+              (objects.y[i] > y_min) & (objects.y[i] < y_max))
+            visit(i);
+        });
+  }
+
+  /**
+   * @brief Broad phase of the collisions, visits the entities of a kind
+   *     whose position may be near the given point, e.g. the snake's particle
+   *
+   * @param kind Kind of the entities
+   * @param x x-position of the point
+   * @param y y-position of the point
+   * @param radius Largest distance of x and y from the point
+   * @param visit Called with the index of each entity
+   */
+  template <typename Visit>
+  void ForEachNear(LevelObject kind, int x, int y, int radius,
+                   Visit visit) const {
+    grids_[static_cast<int>(kind)].ForEachNear(x, y, radius, visit);
+  }
+
+  /**
+   * @brief Draws the visible entities of a kind with the same sprite, looked
+   *     up once for all of them
+   *
+   * @param kind Kind of the entities
+   * @param sprite Sprite of the entities, drawn at their extent
+   * @param fb Framebuffer to be used to draw
+   * @param vp Area of the world @p fb shows
+   */
+  void DrawSprites(LevelObject kind, DILIndex sprite, FrameBuffer *fb,
+                   const Viewport &vp) const;
+
+  /**
+   * @brief Draws the visible entities of a kind with the same baked shape
+   *
+   * @param kind Kind of the entities
+   * @param shape Shape of the entities, drawn at their position
+   * @param fb Framebuffer to be used to draw
+   * @param vp Area of the world @p fb shows
+   */
+  void DrawShapes(LevelObject kind, const BakeShape_t &shape, FrameBuffer *fb,
+                  const Viewport &vp) const;
+
+  // no copy constructor or assignment operator =, the grids are not copyable
+  Entities(const Entities &) = delete;
+  Entities &operator=(const Entities &) = delete;
+};
@@ -41,17 +41,21 @@
 #ifndef FRAMEVIEW_H
 #define FRAMEVIEW_H
 
-#include <graphic/FrameBuffer.hpp>
+#include <graphic/FixedFrameBuffer.hpp>
 #include <graphic/LT177ML35.hpp>
 
 #include "Viewport.hpp"
 
 extern const Color kSnakeBackgroundColor;
 
-class FrameView : public FrameBuffer {
+/**
+ * @brief Full screen framebuffer; dimensions are compile-time constants to
+ * speed up the drawing primitives
+ */
+class FrameView : public FixedFrameBuffer<DISP_WIDTH, DISP_HEIGHT> {
  public:
   FrameView(LT177ML35 &display)
-      : FrameBuffer(static_cast<Display &>(display)){};
+      : FixedFrameBuffer(static_cast<Display &>(display)){};
   void set_viewport(Viewport *viewport) { m_viewport = viewport; };
   Viewport *get_viewport(void) { return m_viewport; };
 
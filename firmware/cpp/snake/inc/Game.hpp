@@ -41,8 +41,13 @@
 #include "Snake.hpp"
 #include "World.hpp"
 
-#define GAME_FPS INT32_C(60)                ///< Game FPS
-#define GAME_FPS_PERIOD_US UINT32_C(16666)  ///< Refer to 60 FPS
+#include <graphic/LT177ML35.hpp>
+
+#define GAME_FPS INT32_C(60)  ///< Simulation steps per second
+#define GAME_STEP_US \
+  (INT32_C(1000000) / GAME_FPS)  ///< Period of a simulation step [us]
+#define GAME_FRAME_RATE \
+  (FrameRate::Rate_59_9Hz)  ///< Panel refresh rate matching GAME_FPS
 
 /**
  * @brief Enum class that is used to divide the game into multiple states
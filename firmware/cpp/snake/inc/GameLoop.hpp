@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * @file GameLoop.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Fixed simulation step of the game, decoupled from drawing
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#include "Physics.hpp"
+
+#define kGameLoopMaxSteps \
+  (4)  ///< Steps run at most to catch up, older time is dropped
+
+/**
+ * @class GameLoop
+ * @brief Runs the simulation in steps of a fixed period, whatever the time of
+ *     a frame is. The time not simulated yet accumulates until it makes up
+ *     whole steps; what remains is the fraction of a step used to interpolate
+ *     between the last two states when drawing. In between, the core sleeps
+ *     with WFE until a hardware alarm raises at the next step.
+ */
+class GameLoop {
+ private:
+  const uint32_t step_us_;          ///< Period of a simulation step [us]
+  volatile uint32_t last_step_us_;  ///< Time the last step simulated up to
+  int alarm_;                       ///< Hardware alarm, -1 if none claimed
+
+ public:
+  /**
+   * @brief Class constructor
+   *
+   * @param step_us Period of a simulation step [us]
+   */
+  explicit GameLoop(uint32_t step_us);
+
+  /**
+   * @brief Starts accumulating from now, e.g. when the game resumes after a
+   *     popup, so the time spent there is not simulated
+   */
+  void Reset(void);
+
+  /**
+   * @brief Takes the whole steps out of the accumulated time
+   *
+   * @return Returns how many steps to simulate now, at most
+   *     kGameLoopMaxSteps
+   */
+  int Advance(void);
+
+  /**
+   * @brief Time the steps simulated so far reach up to, to be handed to the
+   *     other core with the state of the last step
+   *
+   * @return Returns the time [us]
+   */
+  uint32_t GetStepTime(void) const { return last_step_us_; }
+
+  /**
+   * @brief Fraction of a step passed since a step, to draw the state between
+   *     that step and the one before. Safe to call from the other core.
+   *
+   * @param step_time_us GetStepTime() after that step
+   *
+   * @return Returns 0 for the state before the step up to 1.0 for the state
+   *     after it
+   */
+  Fixed_t GetAlpha(uint32_t step_time_us) const;
+
+  /**
+   * @brief Sleeps until the next step is due
+   */
+  void Sleep(void);
+};
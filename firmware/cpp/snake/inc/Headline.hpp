@@ -36,9 +36,8 @@
  *******************************************************************************/
 #pragma once
 
+#include "DynamicImageLoader.hpp"
 #include "FrameView.hpp"
-#include "Object.hpp"
-#include "Physics.hpp"
 
 #define TEXT_MAX_LENGTH (20)  ///< Maximum text length (with null terminator)
 #define HEADLINE_LINES (2)    ///< Headline number of lines
@@ -47,7 +46,7 @@
  * @class Headline
  * @brief Class that represents the Headline text objects on the game
  */
-class Headline : public Object {
+class Headline {
  private:
   /**
    * @brief Deleted constructor
@@ -81,7 +80,7 @@ class Headline : public Object {
 
   char text_[HEADLINE_LINES]
             [TEXT_MAX_LENGTH];  ///< Stores the text that should be displayed
-  Font font_;                   ///< Font to be used for drawing
+  const Font &font_;            ///< Font to be used for drawing
   Color color_;                 ///< Color of the Headline
  public:
   /**
@@ -106,12 +105,12 @@ class Headline : public Object {
   /**
    * @brief Specialized drawing method for the headline
    */
-  void Draw(int x, int y, FrameView *fb) override;
+  void Draw(int x, int y, FrameBuffer *fb);
 
   /**
    * @brief Returns the font reference
    *
    * @return Returns the font reference
    */
-  Font &GetFont(void);
+  const Font &GetFont(void) const;
 };
@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * @file Level.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Levels loaded in place from a blob in flash
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#include "SpatialGrid.hpp"
+
+#define kLevelMagic (0x4c564c4e)  ///< "NLVL" read little endian
+#define kLevelVersion (2)         ///< Version written by utils/from_unity.py
+#define kLevelMaxCoins (512)      ///< Max. collectables, multiple of 32
+#define kLevelMaxTexts (32)       ///< Max. fading text areas, multiple of 32
+
+/**
+ * @brief Kinds of objects of a level, in the order of its object tables
+ */
+enum class LevelObject : int {
+  kBlackHoles = 0,      ///< Black holes, x and y are the center
+  kBumpers,             ///< Bumpers
+  kHeadlines,           ///< Headlines, with text
+  kBoosters,            ///< Speed-up boosters
+  kCollectables,        ///< Coins
+  kPickups,             ///< Pickups opening a fullscreen image
+  kDecorativeHexagons,  ///< Background hexagons
+  kNubixLogos,          ///< Nubix logo
+  k6EArcades,           ///< Heading title
+  kCButtons,            ///< C button
+  kDButtons,            ///< D button
+  kFadingTextAreas,     ///< Fading texts, with text
+  kNumObjects,
+};
+
+/**
+ * @brief Geometry of the objects of a kind, one array per component, stored
+ *     in the level. Index i of every array belongs to the same object.
+ */
+struct LevelObjects_t {
+  const int16_t* x;       ///< x-coordinates
+  const int16_t* y;       ///< y-coordinates
+  const uint8_t* width;   ///< widths of the objects
+  const uint8_t* height;  ///< heights of the objects
+  int count;              ///< Number of objects, the arrays are nullptr if 0
+};
+
+/**
+ * @brief Point of a wall
+ */
+typedef struct LevelPoint_t {
+  int16_t x;  ///< x-coordinate
+  int16_t y;  ///< y-coordinate
+} LevelPoint_t;
+
+/**
+ * @brief Header of a level blob, followed by the object tables and the walls.
+ *     All offsets count from the start of the blob.
+ */
+struct LevelBlob_t {
+  uint32_t magic;      ///< kLevelMagic
+  uint16_t version;    ///< kLevelVersion
+  uint16_t tables;     ///< Number of LevelTable_t, one per LevelObject
+  LevelPoint_t spawn;  ///< Starting point of the snake
+  uint16_t walls;      ///< Number of LevelWall_t, after the tables
+  uint16_t reserved;
+  uint32_t size;  ///< Size of the whole blob [bytes]
+};
+
+/**
+ * @brief Objects of one kind
+ */
+struct LevelTable_t {
+  uint32_t x;       ///< Offset of count int16_t x-coordinates
+  uint32_t y;       ///< Offset of count int16_t y-coordinates
+  uint32_t width;   ///< Offset of count uint8_t widths
+  uint32_t height;  ///< Offset of count uint8_t heights
+  uint32_t texts;   ///< Offset of count uint32_t offsets of zero terminated
+                    ///< texts (0: no text), 0 if the kind has no texts
+  uint32_t grid;    ///< Offset of the SpatialGridBlob_t, 0 if none
+  uint16_t count;   ///< Number of objects
+  uint16_t reserved;
+};
+
+/**
+ * @brief Wall made of horizontal and vertical segments, bumpers are placed
+ *     along it. A closed wall ends with its first point.
+ */
+struct LevelWall_t {
+  uint32_t points;  ///< Offset of count LevelPoint_t
+  uint16_t count;   ///< Number of points
+  uint16_t reserved;
+};
+
+/**
+ * @class Level
+ * @brief Level of the game, read in place from a blob written by
+ *     utils/from_unity.py; nothing is copied or parsed while loading, only
+ *     the offsets are checked.
+ */
+class Level {
+ private:
+  const uint8_t* base_;        ///< Start of the blob, nullptr if not loaded
+  const LevelBlob_t* header_;  ///< Header of the blob
+
+  /**
+   * @brief Gets the table of the given kind
+   *
+   * @return Returns nullptr if the level has no such table
+   */
+  const LevelTable_t* GetTable(LevelObject kind) const;
+
+ public:
+  /**
+   * @brief Class constructor, of an empty level
+   */
+  Level();
+
+  /**
+   * @brief Uses the level stored in the given blob
+   *
+   * @param blob Word aligned blob starting with LevelBlob_t, e.g. in flash
+   * @param size Size of the blob in bytes
+   *
+   * @return Returns false if the blob is invalid or has more coins or fading
+   *     texts than kLevelMaxCoins and kLevelMaxTexts, the level is empty then
+   */
+  bool Load(const uint32_t* blob, uint32_t size);
+
+  /**
+   * @brief Whether a valid level was loaded
+   */
+  bool IsLoaded(void) const { return header_ != nullptr; }
+
+  /**
+   * @brief Number of objects of the given kind
+   */
+  int GetCount(LevelObject kind) const;
+
+  /**
+   * @brief Objects of the given kind
+   *
+   * @return Returns the arrays of GetCount() objects
+   */
+  LevelObjects_t GetObjects(LevelObject kind) const;
+
+  /**
+   * @brief Text of an object
+   *
+   * @param kind Kind of the object
+   * @param i Index of the object
+   *
+   * @return Returns the text, an empty one if the object has none
+   */
+  const char* GetText(LevelObject kind, int i) const;
+
+  /**
+   * @brief Loads the spatial index of the given kind into @p grid, it is
+   *     built when the level has none
+   *
+   * @param kind Kind of the objects
+   * @param grid Grid to be loaded
+   */
+  void LoadGrid(LevelObject kind, SpatialGrid& grid) const;
+
+  /**
+   * @brief Number of walls
+   */
+  int GetWallCount(void) const;
+
+  /**
+   * @brief Points of a wall
+   *
+   * @param i Index of the wall
+   * @param count Set to the number of points
+   *
+   * @return Returns the points of the wall
+   */
+  const LevelPoint_t* GetWall(int i, int& count) const;
+
+  /**
+   * @brief Starting point of the snake
+   */
+  LevelPoint_t GetSpawn(void) const;
+};
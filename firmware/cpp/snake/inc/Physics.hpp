@@ -36,34 +36,105 @@
  *******************************************************************************/
 #pragma once
 
+#include <cstdint>
+
+typedef int32_t Fixed_t;   ///< Q16.16 fixed-point number
+typedef uint16_t Angle_t;  ///< Binary angle, kAngleTurn is a full turn
+
+#define kFixedShift (16)                ///< Fraction bits of Fixed_t
+#define kFixedOne (1 << kFixedShift)    ///< 1.0 as Fixed_t
+#define kAngleTurn (4096)               ///< Angle_t of a full turn, 2^n
+#define kAngleQuarter (kAngleTurn / 4)  ///< Angle_t of a quarter turn
+
+/**
+ * @brief Converts whole pixels into a fixed-point number
+ */
+constexpr Fixed_t ToFixed(int value) { return value * kFixedOne; }
+
+/**
+ * @brief Converts a constant into a fixed-point number, rounded
+ *     Meant for compile-time constants, the game itself uses no float.
+ */
+constexpr Fixed_t ToFixed(double value) {
+  return static_cast<Fixed_t>(value * kFixedOne + (value < 0 ? -0.5 : 0.5));
+}
+
+/**
+ * @brief Converts a fixed-point number into whole pixels, rounded down
+ */
+constexpr int ToInt(Fixed_t value) { return value >> kFixedShift; }
+
+/**
+ * @brief Squared distance of whole pixels, to be compared with
+ *     Particle::DistanceSquaredTo()
+ *
+ * @return Returns the square in Q32.32
+ */
+constexpr int64_t FixedSquare(int pixels) {
+  return static_cast<int64_t>(pixels) * pixels << (2 * kFixedShift);
+}
+
+/**
+ * @brief Converts degrees into a binary angle, rounded
+ */
+constexpr Angle_t ToAngle(int degrees) {
+  return static_cast<Angle_t>(
+      degrees >= 0 ? (degrees * kAngleTurn + 180) / 360
+                   : -((-degrees * kAngleTurn + 180) / 360));
+}
+
+/**
+ * @brief Multiplies two fixed-point numbers
+ */
+inline Fixed_t FixedMul(Fixed_t a, Fixed_t b) {
+  return static_cast<Fixed_t>(static_cast<int64_t>(a) * b >> kFixedShift);
+}
+
+/**
+ * @brief Sine from a table, rounded to half an LSB of Fixed_t
+ *
+ * @param angle Angle of the sine
+ *
+ * @return Returns the sine
+ */
+Fixed_t Sin(Angle_t angle);
+
+/**
+ * @brief Cosine from a table, rounded to half an LSB of Fixed_t
+ *
+ * @param angle Angle of the cosine
+ *
+ * @return Returns the cosine
+ */
+Fixed_t Cos(Angle_t angle);
+
 /**
  * @brief Struct to represent a 2D position on screen alone
  */
 typedef struct Position_t {
-  float x;  ///< x-coordinate
-  float y;  ///< y-coordinate
+  int x;  ///< x-coordinate
+  int y;  ///< y-coordinate
 } Position_t;
 
 /**
  * @class Vector
  * @brief Vector class for physics calculations on objects
+ *     The components are kept as Q16.16, the length and angle are derived
+ *     from them when needed, without floating point.
  */
 class Vector {
- private:
-  float angle_;  ///< Stores the angle between x and y axis
-
  public:
   // We leave x_ and y_ to be directly modifiable if necessary
-  float x_;  ///< x-coordinate
-  float y_;  ///< y-coordinate
+  Fixed_t x_;  ///< x-coordinate
+  Fixed_t y_;  ///< y-coordinate
 
   /**
    * @brief Vector constructor
    *
-   * @param x x-coordinate
-   * @param y y-coordinate
+   * @param x x-coordinate in whole pixels
+   * @param y y-coordinate in whole pixels
    */
-  Vector(float x, float y);
+  Vector(int x, int y);
 
   /**
    * @brief Vector constructor
@@ -71,66 +142,75 @@ class Vector {
   Vector();
 
   /**
-   * @brief Vector destructor
+   * @brief Creates a vector of fixed-point components
+   *
+   * @param x x-coordinate
+   * @param y y-coordinate
+   *
+   * @return Returns the vector
    */
-  ~Vector();
+  static Vector FromFixed(Fixed_t x, Fixed_t y);
 
   /**
-   * @brief Assignment operator
+   * @brief Set length of the vector, keeping its direction
+   *     A vector of length 0 points along the x-axis afterwards.
    */
-  Vector operator=(const Vector& other);
+  void SetLength(Fixed_t length);
 
   /**
-   * @brief Set length of the vector (automatically recalculate angle)
+   * @brief Set the angle of the vector, keeping its length
    */
-  void SetLength(float length);
+  void SetAngle(Angle_t angle);
 
   /**
-   * @brief Set the angle of the vector (automatically recalculate x and y)
+   * @brief Turns the vector by the given angle, keeping its length
+   *
+   * @param angle Angle to turn, positive turns from the x- to the y-axis
    */
-  void SetAngle(float angle);
+  void Rotate(Angle_t angle);
 
   /**
    * @brief Gets the length of the vector
+   *     Prefer GetLengthSquared() for comparisons, it needs no square root.
    *
    * @return Returns the length
    */
-  float GetLength();
+  Fixed_t GetLength() const;
 
   /**
-   * @brief Gets the angle of the vector
+   * @brief Gets the squared length of the vector
    *
-   * @return Returns the angle
+   * @return Returns the squared length in Q32.32
    */
-  float GetAngle();
+  int64_t GetLengthSquared() const;
 
   /**
    * @brief Get x-coordinate of the vector
    *
-   * @return Returns the x-coordinate
+   * @return Returns the x-coordinate in whole pixels, rounded down
    */
-  float GetX();
+  int GetX() const { return ToInt(x_); }
 
   /**
    * @brief Get the y-coordinate of the vector
    *
-   * @param Returns the y-coordinate
+   * @return Returns the y-coordinate in whole pixels, rounded down
    */
-  float GetY();
+  int GetY() const { return ToInt(y_); }
 
   /**
    * @brief Adds the passed vector to this one
    *
    * @return Returns the vector
    */
-  Vector& AddTo(Vector& vector);
+  Vector& AddTo(const Vector& vector);
 
   /**
    * @brief Subtracts the passed vector from this one
    *
    * @return Returns the vector
    */
-  Vector& SubtractFrom(Vector& vector);
+  Vector& SubtractFrom(const Vector& vector);
 
   /**
    * @brief Reverse the vector axis
@@ -168,15 +248,10 @@ class Particle {
   /**
    * @brief Class constructor
    *
-   * @param x x-coordinate
-   * @param y y-coordinate
+   * @param x x-coordinate in whole pixels
+   * @param y y-coordinate in whole pixels
    */
-  Particle(float x, float y);
-
-  /**
-   * @brief Particle destructor
-   */
-  ~Particle();
+  Particle(int x, int y);
 
   /**
    * @brief Sets the mass of the particle
@@ -190,7 +265,7 @@ class Particle {
    *
    * @return Returns the mass of the particle
    */
-  int GetMass();
+  int GetMass() const;
 
   /**
    * @brief Get the vector position of the particle
@@ -213,26 +288,42 @@ class Particle {
 
   /**
    * @brief Gets the particle distance related to the given particle
+   *     Prefer DistanceSquaredTo() for comparisons, it needs no square root.
    *
    * @param particle Particle to calculate the distance
    *
    * @return Returns the distance between the two particles
    */
-  float DistanceTo(Particle& particle);
+  Fixed_t DistanceTo(const Particle& particle) const;
 
   /**
-   * @brief Gravitate the passed particle on this particle
+   * @brief Gets the squared distance to a point, e.g. to compare it with
+   *     FixedSquare() of a radius
    *
-   * @param particle Particle that will suffer the gravity effect
+   * @param x x-coordinate of the point in whole pixels
+   * @param y y-coordinate of the point in whole pixels
+   *
+   * @return Returns the squared distance in Q32.32
    */
-  void GravitateTo(Particle& particle);
+  int64_t DistanceSquaredTo(int x, int y) const;
 
   /**
-   * @brief Returns the angle between this particle and the given particle
+   * @brief Checks if the particle is closer to a point than @p distance
    *
-   * @param particle Particle that will check against
+   * @param x x-coordinate of the point in whole pixels
+   * @param y y-coordinate of the point in whole pixels
+   * @param distance Distance in whole pixels
    *
-   * @return Returns the angle between the two particles
+   * @return Returns true if the distance to the point is less than @p distance
+   */
+  bool IsCloserThan(int x, int y, int distance) const {
+    return DistanceSquaredTo(x, y) < FixedSquare(distance);
+  }
+
+  /**
+   * @brief Gravitate the passed particle on this particle
+   *
+   * @param particle Particle that will suffer the gravity effect
    */
-  float AngleTo(Particle& particle);
+  void GravitateTo(const Particle& particle);
 };
@@ -59,6 +59,7 @@ enum SnakeTurn : uint8_t {
 class Snake {
  private:
   Particle particle_;  ///< Keeps the particle properties of the snake
+  Vector previous_;    ///< Position before the last Update()
   Color color_;        ///< Keeps the color of the snake
 
   Position_t
@@ -88,8 +89,20 @@ class Snake {
    * @brief Draws the snake on the framebuffer
    *
    * @param fb Framebuffer to draw
+   * @param alpha Where to draw the head between the position before and
+   *     after the last Update(), see GameLoop::GetAlpha()
    */
-  void Draw(FrameView& fb);
+  void Draw(FrameView& fb, Fixed_t alpha = kFixedOne);
+
+  /**
+   * @brief Gets the position of the head between the position before and after
+   *     the last Update(), e.g. to center the viewport on the drawn snake
+   *
+   * @param alpha 0 for the position before, 1.0 for the position after
+   *
+   * @return Returns the position in whole pixels
+   */
+  Position_t Interpolate(Fixed_t alpha);
 
   /**
    * @brief Execute the Turn action on the snake
@@ -116,4 +129,12 @@ class Snake {
    * @brief Clears the tail buffer
    */
   void ClearTail();
+
+  /**
+   * @brief Moves the snake to the given position, with the tail gathered there
+   *
+   * @param x New x-position
+   * @param y New y-position
+   */
+  void MoveTo(int x, int y);
 };
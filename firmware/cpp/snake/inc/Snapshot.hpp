@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * @file Snapshot.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief State handed from one core to the other without locking
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <hardware/sync.h>
+#include <pico/platform.h>
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @class Snapshot
+ * @brief Hands a copy of a state from one core, the writer, to the other
+ *     one, the reader, guarded by a sequence lock. The writer never waits; the
+ *     reader copies the state into a buffer of its own and copies again if
+ *     the writer published meanwhile, so it always sees one consistent state.
+ *
+ * @tparam T Trivially copyable state; a torn copy is retried, which is only
+ *     safe when copying never follows pointers the writer may free
+ */
+template <typename T>
+class Snapshot {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Snapshot state must be trivially copyable");
+
+ private:
+  T shared_;                    ///< Last published state
+  volatile uint32_t sequence_;  ///< Odd while the writer copies into shared_
+
+ public:
+  /**
+   * @brief Class constructor
+   *
+   * @param initial State read until the first Publish()
+   */
+  explicit Snapshot(const T& initial) : shared_(initial), sequence_(0) {}
+
+  /**
+   * @brief Publishes a new state, to be called by the writer only
+   *
+   * @param write Called with the shared state to be updated
+   */
+  template <typename Write>
+  void Publish(Write write) {
+    sequence_ = sequence_ + 1;
+    __dmb();
+    write(shared_);
+    __dmb();
+    sequence_ = sequence_ + 1;
+  }
+
+  /**
+   * @brief Copies the last published state, to be called by the reader only
+   *
+   * @param state Buffer of the reader
+   */
+  void Read(T& state) const {
+    uint32_t sequence;
+
+    do {
+      while ((sequence = sequence_) & 1) tight_loop_contents();
+      __dmb();
+      state = shared_;
+      __dmb();
+    } while (sequence != sequence_);
+  }
+};
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * @file SpatialGrid.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Uniform grid index over the positions of world objects
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#define kSpatialGridCell (128)  ///< Edge of a grid cell [px], about a screen
+
+/**
+ * @brief Header of a grid built ahead of time, e.g. stored in a level, read in
+ *     place. It is followed by the uint16_t first item of each cell (columns *
+ *     rows + 1 values, row by row) and the uint16_t object indices.
+ */
+struct SpatialGridBlob_t {
+  int16_t x0;          ///< Left of the grid, smallest object x
+  int16_t y0;          ///< Top of the grid, smallest object y
+  uint16_t columns;    ///< Number of cell columns
+  uint16_t rows;       ///< Number of cell rows
+  uint16_t cell;       ///< Edge of a cell [px]
+  uint8_t max_width;   ///< Widest object
+  uint8_t max_height;  ///< Highest object
+};
+
+/**
+ * @class SpatialGrid
+ * @brief Index of world objects by the grid cell of their position (x, y).
+ *     The grid is built once; queries visit the objects of the cells
+ *     overlapping the queried area, so the cost follows the size of the area
+ *     and not the size of the world. Visited objects are candidates, the
+ *     caller still does the exact visibility or collision test.
+ */
+class SpatialGrid {
+ private:
+  int x0_;                  ///< Left of the grid, smallest object x
+  int y0_;                  ///< Top of the grid, smallest object y
+  int columns_;             ///< Number of cell columns
+  int rows_;                ///< Number of cell rows
+  int cell_;                ///< Edge of a cell [px]
+  int max_width_;           ///< Widest object, extent to the right of x
+  int max_height_;          ///< Highest object, extent below y
+  const uint16_t* starts_;  ///< First item of each cell, and the end of the
+                            ///< last
+  const uint16_t* items_;   ///< Object indices, sorted by cell
+  bool owned_;              ///< Whether starts_ and items_ were allocated
+
+  /**
+   * @brief Releases the cells and allocates empty ones for objects within the
+   *     given positions
+   *
+   * @param x_min Smallest object x
+   * @param y_min Smallest object y
+   * @param x_max Largest object x
+   * @param y_max Largest object y
+   * @param count Number of objects
+   * @param items Set to the object indices to be filled in
+   *
+   * @return Returns the zeroed first items of the cells to be filled in,
+   *     nullptr if there are no objects
+   */
+  uint16_t* Allocate(int x_min, int y_min, int x_max, int y_max, int count,
+                     uint16_t** items);
+
+  /**
+   * @brief Releases the cells, the grid is empty afterwards
+   */
+  void Release(void);
+
+  /**
+   * @brief Cell column of a x-position, clamped to the grid
+   */
+  int Column(int x) const;
+
+  /**
+   * @brief Cell row of a y-position, clamped to the grid
+   */
+  int Row(int y) const;
+
+ public:
+  /**
+   * @brief Class constructor, of an empty grid
+   */
+  SpatialGrid();
+
+  /**
+   * @brief Class destructor
+   */
+  ~SpatialGrid();
+
+  /**
+   * @brief Uses a grid built ahead of time, in place
+   *
+   * @param blob Grid followed by its cells and items, 2-byte aligned
+   * @param size Bytes readable from @p blob
+   * @param count Number of indexed objects
+   *
+   * @return Returns false if the grid is invalid, the grid is empty then
+   */
+  bool Load(const SpatialGridBlob_t* blob, uint32_t size, int count);
+
+  /**
+   * @brief Indexes the given objects, replacing the previous ones
+   *
+   * @param x x-coordinates of the objects
+   * @param y y-coordinates of the objects
+   * @param width Widths of the objects
+   * @param height Heights of the objects
+   * @param count Number of objects, up to 65535
+   */
+  void Build(const int16_t* x, const int16_t* y, const uint8_t* width,
+             const uint8_t* height, int count);
+
+  /**
+   * @brief Visits the objects whose position is in the cells overlapping the
+   *     given area of positions
+   *
+   * @param x_min Left of the area
+   * @param y_min Top of the area
+   * @param x_max Right of the area, inclusive
+   * @param y_max Bottom of the area, inclusive
+   * @param visit Called with the index of each object
+   */
+  template <typename Visit>
+  void ForEach(int x_min, int y_min, int x_max, int y_max, Visit visit) const {
+    if (starts_ == nullptr) return;
+
+    int column_max = Column(x_max);
+    int row_max = Row(y_max);
+    for (int row = Row(y_min); row <= row_max; row++) {
+      const uint16_t* cell = &starts_[row * columns_];
+      for (int i = cell[Column(x_min)]; i < cell[column_max + 1]; i++)
+        visit(items_[i]);
+    }
+  }
+
+  /**
+   * @brief Visits the objects which may intersect the given area, e.g. the
+   *     viewport; objects extend by their width and height from x and y
+   *
+   * @param x Left of the area
+   * @param y Top of the area
+   * @param width Width of the area
+   * @param height Height of the area
+   * @param visit Called with the index of each object
+   */
+  template <typename Visit>
+  void ForEachInArea(int x, int y, int width, int height, Visit visit) const {
+    ForEach(x - max_width_, y - max_height_, x + width, y + height, visit);
+  }
+
+  /**
+   * @brief Visits the objects whose position may be near the given point,
+   *     e.g. the snake's particle
+   *
+   * @param x x-position of the point
+   * @param y y-position of the point
+   * @param radius Largest distance of x and y from the point
+   * @param visit Called with the index of each object
+   */
+  template <typename Visit>
+  void ForEachNear(int x, int y, int radius, Visit visit) const {
+    ForEach(x - radius, y - radius, x + radius, y + radius, visit);
+  }
+
+  // no copy constructor or assignment operator = to avoid double free
+  SpatialGrid(const SpatialGrid&) = delete;
+  SpatialGrid& operator=(const SpatialGrid&) = delete;
+};
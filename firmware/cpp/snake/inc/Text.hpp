@@ -36,9 +36,8 @@
  *******************************************************************************/
 #pragma once
 
+#include "DynamicImageLoader.hpp"
 #include "FrameView.hpp"
-#include "Object.hpp"
-#include "Physics.hpp"
 
 #define TEXT_MAX_LENGTH (20)    ///< Maximum text length (with null terminator)
 #define TEXT_MAX_NUM_LINES (3)  ///< Text maximum number of lines
@@ -52,7 +51,7 @@ enum class TextSize : uint8_t {
  * @class Text
  * @brief Class that represents the Text on the screen
  */
-class Text : public Object {
+class Text {
  private:
   Text(const Text &) = delete;
   Text(Text &&) = delete;
@@ -140,15 +139,4 @@ class Text : public Object {
    * @param y y-coordinate (top-left corner)
    */
   void Draw(FrameView *fb, Color color, int x, int y);
-
-  /**
-   * @brief Returns if the text is visible on the screen
-   *
-   * @param x x-coordinate
-   * @param y y-coordinate
-   * @param fb Framebuffer to check
-   *
-   * @return Returns True if is visible; False otherwise
-   */
-  bool IsVisible(int x, int y, FrameView *fb);
 };
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * @file TileCache.hpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Cache of the static world layer rasterized into tiles
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#include "FrameView.hpp"
+#include "Viewport.hpp"
+
+#define kTileSize (32)  ///< Edge of a tile [px]
+/// Max. SRAM used by tile pixels, the up to 6 x 5 tiles of the screen and a
+/// margin for scrolling
+#define kTileCacheBudget (64 * 1024)
+#define kTileCacheEntries (48)  ///< Max. number of tiles, empty ones too
+
+/**
+ * @brief Draws the static layer of the world
+ *
+ * @param fb Framebuffer to draw into, cleared to kSnakeBackgroundColor
+ * @param vp Area of the world @p fb shows
+ */
+typedef void (*TileRender_t)(FrameBuffer *fb, const Viewport &vp);
+
+/**
+ * @class TileCache
+ * @brief Rasterizes the static layer of the world into tiles of kTileSize,
+ *     aligned to the world, when they are seen first, and blits them on later
+ *     frames. Tiles showing the background only take no SRAM. Least recently
+ *     used tiles are dropped to stay within the budget.
+ */
+class TileCache {
+ private:
+  /**
+   * @brief Rasterized tile of the world
+   */
+  struct Entry_t {
+    int16_t column;      ///< x of the tile divided by kTileSize
+    int16_t row;         ///< y of the tile divided by kTileSize
+    bool used;           ///< Whether the slot holds a tile
+    uint16_t *pixels;    ///< RGB565 pixels, nullptr for an empty tile
+    Sprite *sprite;      ///< Sprite showing pixels
+    uint32_t last_used;  ///< Value of clock_ when used last
+  };
+
+  Entry_t entries_[kTileCacheEntries];  ///< Tiles
+  Color canvas_[kTileSize * kTileSize];  ///< Tile being rasterized
+  uint32_t usage_;                       ///< SRAM used by all tile pixels
+  uint32_t clock_;                       ///< Counts lookups, for LRU
+
+  /**
+   * @brief Class constructor
+   */
+  TileCache();
+
+  /**
+   * @brief Frees least recently used tiles until there is a free slot and
+   *     @p bytes fit into the budget
+   *
+   * @param bytes Size of the tile to be added
+   *
+   * @return Returns the free slot
+   */
+  Entry_t &Evict(uint32_t bytes);
+
+  /**
+   * @brief Releases the tile of the given slot
+   *
+   * @param entry Slot to free
+   */
+  void Release(Entry_t &entry);
+
+  /**
+   * @brief Finds the given tile, rasterizes it if it is not cached
+   *
+   * @param column Column of the tile
+   * @param row Row of the tile
+   * @param render Drawing of the static layer
+   *
+   * @return Returns the tile
+   */
+  const Entry_t &Get(int column, int row, TileRender_t render);
+
+ public:
+  /**
+   * @brief Gets the static instance of the class
+   *
+   * @return Returns a reference to the TileCache object
+   */
+  static TileCache &GetInstance();
+
+  /**
+   * @brief Blits the tiles of the viewport of @p fb, which must be cleared to
+   *     kSnakeBackgroundColor before
+   *
+   * @param fb Framebuffer where the tiles will be drawn
+   * @param render Drawing of the static layer, the same on every call
+   */
+  void Draw(FrameView *fb, TileRender_t render);
+
+  /**
+   * @brief Drops all tiles to free the SRAM, also when the static layer
+   *     changed
+   */
+  void Clear(void);
+
+  /**
+   * @brief SRAM used by tile pixels
+   *
+   * @return Returns the number of bytes
+   */
+  uint32_t GetUsage(void) const { return usage_; }
+};
@@ -36,13 +36,18 @@
  *******************************************************************************/
 #pragma once
 
+#include <cstdint>
+
 #include "DynamicImageLoader.hpp"
 #include "FrameView.hpp"
+#include "Level.hpp"
 #include "Physics.hpp"
 #include "Snake.hpp"
 
 extern FrameView *frameBuffer;  ///< Extern reference to the frameview
 
+#define kWorldPrefetchFrames (30)  ///< Look-ahead of WorldPrefetch() [frames]
+
 /**
  * @brief Indicates the possible actions/states of the game
  */
@@ -64,21 +69,62 @@ enum class Action : int {
 };
 
 /**
- * @brief Initializes the game's world
+ * @brief State of the world objects which WorldUpdate() changes and
+ *     WorldDraw() shows, so the core drawing can work on a copy. Bit arrays of
+ *     fixed size, copying never touches the heap.
+ */
+struct WorldState_t {
+  uint32_t coins_picked[kLevelMaxCoins / 32];  ///< Coins collected by the snake
+  uint32_t texts_picked[kLevelMaxTexts / 32];  ///< Fading texts passed by
+
+  /**
+   * @brief Reads bit @p i of @p bits
+   */
+  static bool Get(const uint32_t *bits, int i) {
+    return (bits[i >> 5] >> (i & 31)) & 1;
+  }
+
+  /**
+   * @brief Sets bit @p i of @p bits to @p value
+   */
+  static void Set(uint32_t *bits, int i, bool value) {
+    uint32_t mask = UINT32_C(1) << (i & 31);
+    bits[i >> 5] = value ? (bits[i >> 5] | mask) : (bits[i >> 5] & ~mask);
+  }
+};
+
+/**
+ * @brief Initializes the game's world with the level of the asset pack
  */
 void WorldInit();
 
+/**
+ * @brief Places the snake at the starting point of the level, it stays where
+ *     it is if no level is loaded
+ *
+ * @param snake Snake to be placed
+ */
+void WorldSpawn(Snake &snake);
+
 /**
  * @brief Deinitialize the game's world
  */
 void WorldDeinit();
 
+/**
+ * @brief Copies the state of the world after the last WorldUpdate()
+ *
+ * @param state State to be overwritten
+ */
+void WorldGetState(WorldState_t &state);
+
 /**
  * @brief Draws the world
  *
  * @param fb Framebuffer to be used to draw
+ * @param state State of the objects to be drawn, see WorldGetState()
  */
-void WorldDraw(FrameView *fb);
+void WorldDraw(FrameView *fb, const WorldState_t &state);
 
 /**
  * @brief Update the world
@@ -89,3 +135,13 @@ void WorldDraw(FrameView *fb);
  * @return Returns the next Action state
  */
 Action WorldUpdate(FrameView *fb, Particle &particle);
+
+/**
+ * @brief Loads the sprites of the objects the viewport will reach within the
+ *     next kWorldPrefetchFrames frames, when following the snake's velocity.
+ *     Meant for the core that is idle while the other one draws the frame.
+ *
+ * @param vp Viewport following the snake
+ * @param particle Particle of the snake
+ */
+void WorldPrefetch(Viewport *vp, Particle &particle);
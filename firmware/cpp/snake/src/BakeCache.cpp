@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * @file BakeCache.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Cache of procedurally drawn objects baked into sprites
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include "BakeCache.hpp"
+
+BakeCache::BakeCache() : usage_(0), clock_(0) {
+  for (int i = 0; i < kBakeCacheEntries; i++) entries_[i].sprite = nullptr;
+}
+
+BakeCache &BakeCache::GetInstance() {
+  static BakeCache instance;
+  return instance;
+}
+
+void BakeCache::Release(Entry_t &entry) {
+  if (entry.sprite == nullptr) return;
+
+  usage_ -= entry.sprite->get_size();
+  delete entry.sprite;
+  entry.sprite = nullptr;
+}
+
+BakeCache::Entry_t &BakeCache::Evict(uint32_t bytes) {
+  while (true) {
+    Entry_t *free = nullptr;
+    Entry_t *oldest = nullptr;
+
+    for (int i = 0; i < kBakeCacheEntries; i++) {
+      Entry_t &entry = entries_[i];
+      if (entry.sprite == nullptr) {
+        if (free == nullptr) free = &entry;
+      } else if (oldest == nullptr || entry.last_used < oldest->last_used)
+        oldest = &entry;
+    }
+
+    if (free != nullptr && usage_ + bytes <= kBakeCacheBudget) return *free;
+
+    /* bytes <= budget, so there is always something left to evict */
+    Release(*oldest);
+  }
+}
+
+Sprite *BakeCache::Get(const BakeShape_t &shape) {
+  uint32_t bytes = shape.width * shape.height * 4;
+
+  clock_++;
+  for (int i = 0; i < kBakeCacheEntries; i++) {
+    Entry_t &entry = entries_[i];
+    if (entry.sprite && entry.id == shape.id && entry.params == shape.params) {
+      entry.last_used = clock_;
+      return entry.sprite;
+    }
+  }
+
+  if (bytes > kBakeCacheBudget) return nullptr;
+
+  Entry_t &entry = Evict(bytes);
+  Sprite *sprite =
+      new Sprite(shape.width, shape.height, PixelFormat::ARGB8888Pre);
+  /* drawing onto the transparent sprite leaves premultiplied colors, which
+   * blend to the same result as drawing directly on the screen */
+  FrameBuffer canvas(shape.width, shape.height, sprite->getPixels());
+  shape.render(&canvas, shape.origin_x, shape.origin_y, shape.params);
+
+  entry.id = shape.id;
+  entry.params = shape.params;
+  entry.sprite = sprite;
+  entry.last_used = clock_;
+  usage_ += bytes;
+
+  return sprite;
+}
+
+void BakeCache::Invalidate(BakeId id) {
+  for (int i = 0; i < kBakeCacheEntries; i++)
+    if (entries_[i].id == id) Release(entries_[i]);
+}
+
+void BakeCache::Clear(void) {
+  for (int i = 0; i < kBakeCacheEntries; i++) Release(entries_[i]);
+}
@@ -36,41 +36,30 @@
  *******************************************************************************/
 #include "BlackHole.hpp"
 
-#include "DynamicImageLoader.hpp"
+#include "BakeCache.hpp"
 
 #define kBlackHoleWidth (104)  ///< The outer-most width of the black hole
 #define kGravityPull \
-  (0.00005)  ///< Gravity force when reached inner side of black hole
-
-BlackHole::BlackHole() {
-  Object::SetType(kBlackHoleWidth, kBlackHoleWidth, DILIndex::kBlackHole);
-}
-
-BlackHole &BlackHole::GetInstance() {
-  static BlackHole instance;
-  return instance;
-}
+  (0)  ///< Gravity force when reached inner side of black hole
 
 void BlackHole::GravityPull(int x, int y, Particle &particle) {
-  Vector &vector = particle.GetPosition();
   int radius = (kBlackHoleWidth >> 1);
-
-  Particle p(x, y);
-
-  float distance = p.DistanceTo(particle);
-  bool collided = (distance <= static_cast<float>(radius));
+  int64_t distance_squared = particle.DistanceSquaredTo(x, y);
+  bool collided = (distance_squared <= FixedSquare(radius));
 
   if (!collided) return;
 
-  if (distance < static_cast<float>(radius >> 1))
+  Particle p(x, y);
+
+  if (distance_squared < FixedSquare(radius >> 1))
     p.SetMass(kGravityPull);
-  else
-    p.SetMass(distance * 2 + 50);  // TODO: empiric magic number for gravity :)
+  else  // TODO: empiric magic number for gravity :)
+    p.SetMass(ToInt(p.DistanceTo(particle)) * 2 + 50);
 
   particle.GravitateTo(p);
 }
 
-void BlackHole::Draw(int x, int y, FrameView *fb) {
+void BlackHole::Render(FrameBuffer *fb, int x, int y, uint32_t /*params*/) {
   fb->circle_filled6(x, y, 38, Color::Gray);
   fb->circle_filled6(x, y, 35, kSnakeBackgroundColor);
 
@@ -84,3 +73,16 @@ void BlackHole::Draw(int x, int y, FrameView *fb) {
   fb->circle_filled3(x, y, 5, kSnakeBackgroundColor);
   fb->circle_filled3(x, y, 2, Color::Cyan);
 }
+
+const BakeShape_t &BlackHole::GetShape(void) {
+  /* outer ring is drawn up to radius 38 + 1 */
+  static const BakeShape_t shape = {.id = BakeId::kBlackHole,
+                                    .params = 0,
+                                    .width = 79,
+                                    .height = 79,
+                                    .origin_x = 39,
+                                    .origin_y = 39,
+                                    .render = &BlackHole::Render};
+
+  return shape;
+}
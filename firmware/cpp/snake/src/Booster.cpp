@@ -36,27 +36,15 @@
  *******************************************************************************/
 #include "Booster.hpp"
 
-#include "DynamicImageLoader.hpp"
+#include "BakeCache.hpp"
 
-#define kBoosterAcceleration (0.5)  ///< Acceleration caused by the booster
+#define kBoosterAcceleration \
+  (ToFixed(0.5))  ///< Acceleration caused by the booster
 #define kBoosterRadius (9)          ///< Radius of the buster
-#define kBoosterWidth (19)          ///< Width of the booster
-#define kBoosterHeight (19)         ///< Height of the booster
-
-Booster::Booster() {
-  SetType(kBoosterWidth, kBoosterHeight, DILIndex::kSpeedup);
-}
-
-Booster &Booster::GetInstance() {
-  static Booster instance;
-  return instance;
-}
 
 bool Booster::CheckCollision(int x, int y, Particle &particle) {
-  Particle p(x + kBoosterRadius, y + kBoosterRadius);
-
-  float distance = p.DistanceTo(particle);
-  bool collided = distance < static_cast<float>(kBoosterRadius << 1);
+  bool collided = particle.IsCloserThan(x + kBoosterRadius, y + kBoosterRadius,
+                                       kBoosterRadius << 1);
 
   if (collided)
     particle.GetVelocity().SetLength(particle.GetVelocity().GetLength() +
@@ -65,7 +53,19 @@ bool Booster::CheckCollision(int x, int y, Particle &particle) {
   return collided;
 }
 
-void Booster::Draw(int x, int y, FrameView *fb) {
+void Booster::Render(FrameBuffer *fb, int x, int y, uint32_t /*params*/) {
   fb->circle_filled2(x, y, kBoosterRadius, static_cast<Color>(0x5f00e699));
   fb->circle_filled2(x, y, kBoosterRadius >> 2, Color::Cyan);
 }
+
+const BakeShape_t &Booster::GetShape(void) {
+  static const BakeShape_t shape = {.id = BakeId::kBooster,
+                                    .params = 0,
+                                    .width = 2 * kBoosterRadius + 1,
+                                    .height = 2 * kBoosterRadius + 1,
+                                    .origin_x = kBoosterRadius,
+                                    .origin_y = kBoosterRadius,
+                                    .render = &Booster::Render};
+
+  return shape;
+}
@@ -36,56 +36,51 @@
  *******************************************************************************/
 #include "Bumper.hpp"
 
-#include <cmath>
+#include <cstdlib>
 
-#include "DynamicImageLoader.hpp"
+#include "BakeCache.hpp"
 
 #define kBoosterWidth (18)  ///< Bumper width
 
-Bumper::Bumper() { SetType(kBoosterWidth, kBoosterWidth, DILIndex::kBumper); }
+#define THRESHOLD \
+  (ToFixed(14))  ///< Threshold to detect if the collision happened
 
-Bumper &Bumper::GetInstance() {
-  static Bumper instance;
-  return instance;
-}
-
-#define THRESHOLD 14  ///< Threshold to detect if the collision happened
-
-#define kBumperAcceleration (2.5)  ///< Acceleration when bumped
+#define kBumperAcceleration (ToFixed(2.5))  ///< Acceleration when bumped
 #define kBumperMaxAcceleration \
-  (5)  ///< Define the maximum acceleration that the bumper can affect the snake
+  (ToFixed(5))  ///< Define the maximum acceleration that the bumper can affect
+                ///< the snake
 
 bool Bumper::CheckCollision(int x, int y, Particle &particle) {
+  Fixed_t px = particle.GetPosition().x_;
+  Fixed_t py = particle.GetPosition().y_;
+
   /* first check the bound-box of collision which is cheaper to process */
-  bool collided = (particle.GetPosition().GetX() > x &&
-                   particle.GetPosition().GetX() < x + kBoosterWidth &&
-                   particle.GetPosition().GetY() > y &&
-                   particle.GetPosition().GetY() < y + kBoosterWidth);
+  bool collided = (px > ToFixed(x) && px < ToFixed(x + kBoosterWidth) &&
+                   py > ToFixed(y) && py < ToFixed(y + kBoosterWidth));
 
   if (!collided) return collided;
 
-  float x1 = static_cast<float>(x) + static_cast<float>(kBoosterWidth >> 1);
-  float x2 = static_cast<float>(x) + static_cast<float> kBoosterWidth;
-  float x3 = static_cast<float>(x) + static_cast<float>(kBoosterWidth >> 1);
-  float x4 = static_cast<float>(x);
-  float y1 = static_cast<float>(y);
-  float y2 = static_cast<float>(y) + static_cast<float>(kBoosterWidth >> 1);
-  float y3 = static_cast<float>(y) + static_cast<float>(kBoosterWidth);
-  float y4 = static_cast<float>(y) + static_cast<float>(kBoosterWidth >> 1);
-
-  float y_expected_line1 = particle.GetPosition().GetX() + y1 - x1;
-  float y_expected_line2 = -particle.GetPosition().GetX() + y2 + x2;
-  float y_expected_line3 = particle.GetPosition().GetX() + y3 - x3;
-  float y_expected_line4 = -particle.GetPosition().GetX() + y4 + x4;
-
-  if (std::abs(y_expected_line1 - particle.GetPosition().GetY()) <= THRESHOLD ||
-      std::abs(y_expected_line2 - particle.GetPosition().GetY()) <= THRESHOLD ||
-      std::abs(y_expected_line3 - particle.GetPosition().GetY()) <= THRESHOLD ||
-      std::abs(y_expected_line4 - particle.GetPosition().GetY()) <= THRESHOLD) {
-    float velocity = particle.GetVelocity().GetLength();
+  Fixed_t x1 = ToFixed(x + (kBoosterWidth >> 1));
+  Fixed_t x2 = ToFixed(x + kBoosterWidth);
+  Fixed_t x3 = ToFixed(x + (kBoosterWidth >> 1));
+  Fixed_t x4 = ToFixed(x);
+  Fixed_t y1 = ToFixed(y);
+  Fixed_t y2 = ToFixed(y + (kBoosterWidth >> 1));
+  Fixed_t y3 = ToFixed(y + kBoosterWidth);
+  Fixed_t y4 = ToFixed(y + (kBoosterWidth >> 1));
+
+  Fixed_t y_expected_line1 = px + y1 - x1;
+  Fixed_t y_expected_line2 = -px + y2 + x2;
+  Fixed_t y_expected_line3 = px + y3 - x3;
+  Fixed_t y_expected_line4 = -px + y4 + x4;
+
+  if (std::abs(y_expected_line1 - py) <= THRESHOLD ||
+      std::abs(y_expected_line2 - py) <= THRESHOLD ||
+      std::abs(y_expected_line3 - py) <= THRESHOLD ||
+      std::abs(y_expected_line4 - py) <= THRESHOLD) {
+    Fixed_t velocity = particle.GetVelocity().GetLength();
     if (velocity < kBumperMaxAcceleration)
-      particle.GetVelocity().SetLength(particle.GetVelocity().GetLength() +
-                                       kBumperAcceleration);
+      particle.GetVelocity().SetLength(velocity + kBumperAcceleration);
     else
       particle.GetVelocity().SetLength(kBumperMaxAcceleration);
     particle.GetVelocity().ReverseX();
@@ -99,7 +94,7 @@ bool Bumper::CheckCollision(int x, int y, Particle &particle) {
 #define BUMPER_COLOR \
   0xff70dbdb  // source: https://www.w3schools.com/colors/colors_picker.asp
 
-void Bumper::Draw(int x, int y, FrameView *fb) {
+void Bumper::Render(FrameBuffer *fb, int x, int y, uint32_t /*params*/) {
   Color color = static_cast<Color>(BUMPER_COLOR);
   fb->line_soft2(x + (kBoosterWidth >> 1), y, x + kBoosterWidth,
                  y + (kBoosterWidth >> 1), 3, color);
@@ -116,3 +111,16 @@ void Bumper::Draw(int x, int y, FrameView *fb) {
   fb->circle_filled2(x + (kBoosterWidth >> 1), y + (kBoosterWidth >> 1), 3,
                      color);
 }
+
+const BakeShape_t &Bumper::GetShape(void) {
+  /* thick lines grow by 2 pixels above and below */
+  static const BakeShape_t shape = {.id = BakeId::kBumper,
+                                    .params = 0,
+                                    .width = kBoosterWidth + 1,
+                                    .height = kBoosterWidth + 5,
+                                    .origin_x = 0,
+                                    .origin_y = 2,
+                                    .render = &Bumper::Render};
+
+  return shape;
+}
@@ -38,34 +38,38 @@
 
 #include <cstdint>
 
+#include "BakeCache.hpp"
+
 #define COIN_BG_COLOR (0xFFCC7800)  ///< Background color of the coin
 #define COIN_FG_COLOR (0xFFFFFF64)  ///< Foreground color of the coin
 
-Coin::Coin() : collected_(false) {}
-
-Coin &Coin::GetInstance() {
-  static Coin instance;
-  return instance;
-}
-
-bool Coin::CheckCollision(int x, int y, Particle &particle) {
-  Particle p(x, y);
-  float distance = p.DistanceTo(particle);
-
+bool Coin::CheckCollision(int x, int y, int radius, Particle &particle) {
   /* For the coins, we increase the radius to check the collision,
    * otherwise, it would be very hard for the Snake to collect these small coins
    */
-  bool collided = distance < static_cast<float>(2 * width_);
+  bool collided = particle.IsCloserThan(x, y, 2 * radius);
 
   return collided;
 }
 
-void Coin::Draw(int x, int y, FrameView *fb) {
-  if (!collected_) {
-    fb->circle_filled2(x, y, width_, static_cast<Color>(COIN_BG_COLOR));
+void Coin::Render(FrameBuffer *fb, int x, int y, uint32_t params) {
+  unsigned int radius = params & 0xff;
+
+  if (!(params & 0x100)) {
+    fb->circle_filled2(x, y, radius, static_cast<Color>(COIN_BG_COLOR));
     fb->circle_filled2(x, y, 2, static_cast<Color>(COIN_FG_COLOR));
   } else
-    fb->circle_filled2(x, y, width_, Color::DarkGray);
+    fb->circle_filled2(x, y, radius, Color::DarkGray);
 }
 
-void Coin::SetCollected(bool collected) { collected_ = collected; }
+BakeShape_t Coin::GetShape(int radius, bool collected) {
+  /* a changed size or state results in another baked sprite */
+  return BakeShape_t{
+      .id = BakeId::kCoin,
+      .params = static_cast<uint32_t>((radius & 0xff) | (collected << 8)),
+      .width = static_cast<uint16_t>(2 * radius + 1),
+      .height = static_cast<uint16_t>(2 * radius + 1),
+      .origin_x = static_cast<int16_t>(radius),
+      .origin_y = static_cast<int16_t>(radius),
+      .render = &Coin::Render};
+}
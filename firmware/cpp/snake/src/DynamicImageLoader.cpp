@@ -37,50 +37,93 @@
 #include "DynamicImageLoader.hpp"
 
 #include <incbin.h>
+#include <pico/mutex.h>
 
-#include <graphic/PngImage.hpp>
+#include "WorldAtlas.hpp"
 
 /**
- * @brief Include of the images needed by the snake game
+ * @brief Include of the assets needed by the snake game
+ *     The sprite blobs are compiled from the PNG files in sprites/ and packed
+ *     together with the fonts by the build, see asset_pack() in
+ *     snake/CMakeLists.txt
  */
-INCBIN(uint32_t, BackgroundNubixImg, "./background/Nubix.png");
-INCBIN(uint32_t, ButtonCImg, "./button/C_s.png");
-INCBIN(uint32_t, ButtonDImg, "./button/D_s.png");
-INCBIN(uint32_t, FullscreenFlashImg, "./fullscreen/Flash_s.png");
-INCBIN(uint32_t, FullscreenManufacture1Img, "./fullscreen/Manufacture1_s.png");
-INCBIN(uint32_t, FullscreenManufacture2Img, "./fullscreen/Manufacture2_s.png");
-INCBIN(uint32_t, FullscreenSourceCodeImg, "./fullscreen/SourceCode.png");
-INCBIN(uint32_t, FullscreenQrCodeCreditsImg, "./fullscreen/QrCodeCredits.png");
-INCBIN(uint32_t, HeadingTitleImg, "./background/Title_s.png");
-INCBIN(uint32_t, PickupImg, "./pickup/About_s.png");
-// INCBIN(uint32_t, NubixLogoImg, "./NubixLogo.png");
-INCBIN(uint32_t, HexagonImg, "./background/Hexagon.png");
+INCBIN(uint32_t, AssetsPack, "./Assets.pack");
+
+/* GetSprite() runs on the drawing core, Prefetch() on the updating core */
+auto_init_mutex(dil_mutex);
+
+/**
+ * @brief Name of a sprite in the asset pack and its area inside the blob
+ */
+struct DILAsset_t {
+  uint32_t name;           ///< AssetPack::hash() of the name, 0 if no image
+  const SpriteRect* rect;  ///< Area inside the atlas blob, nullptr if the
+                           ///< blob holds this sprite only
+};
+
+/**
+ * @brief DILAsset_t of an image inside the world atlas
+ */
+#define WORLD_ATLAS(name)                                                  \
+  {                                                                        \
+    AssetPack::hash("WorldAtlas"),                                         \
+        &kWorldAtlasRects[static_cast<int>(WorldAtlasRect::k##name)]       \
+  }
+
+/**
+ * @brief Assets of the sprites, in the order of DILIndex
+ */
+static const DILAsset_t kAssets[static_cast<int>(DILIndex::kNumDIL)] = {
+    WORLD_ATLAS(Nubix),
+    WORLD_ATLAS(ButtonC),
+    WORLD_ATLAS(ButtonD),
+    {AssetPack::hash("fullscreen/Flash"), nullptr},
+    {AssetPack::hash("fullscreen/Manufacture1"), nullptr},
+    {AssetPack::hash("fullscreen/Manufacture2"), nullptr},
+    {AssetPack::hash("fullscreen/SourceCode"), nullptr},
+    {AssetPack::hash("fullscreen/QrCodeCredits"), nullptr},
+    WORLD_ATLAS(Title),
+    {AssetPack::hash("pickup/About"), nullptr},
+    {0, nullptr},  // kNubixLogo, no image yet
+    WORLD_ATLAS(Hexagon),
+};
+
+/**
+ * @brief Assets of the fonts, in the order of DILFont
+ */
+static const uint32_t kFontAssets[static_cast<int>(DILFont::kNumFonts)] = {
+    AssetPack::hash("font/AzaretSmall"),
+    AssetPack::hash("font/AzaretLarge"),
+};
+
+/**
+ * @brief Font of missing font assets, draws nothing
+ */
+static const Font kNoFont{95, 0, nullptr};
 
 DIL::DIL()
-    : sprites_{{.data = &gBackgroundNubixImgData[0],
-                .size = gBackgroundNubixImgSize},
-               {.data = &gButtonCImgData[0], .size = gButtonCImgSize},
-               {.data = &gButtonDImgData[0], .size = gButtonDImgSize},
-               {.data = &gFullscreenFlashImgData[0],
-                .size = gFullscreenFlashImgSize},
-               {.data = &gFullscreenManufacture1ImgData[0],
-                .size = gFullscreenManufacture1ImgSize},
-               {.data = &gFullscreenManufacture2ImgData[0],
-                .size = gFullscreenManufacture2ImgSize},
-               {.data = &gFullscreenSourceCodeImgData[0],
-                .size = gFullscreenSourceCodeImgSize},
-               {.data = &gFullscreenQrCodeCreditsImgData[0],
-                .size = gFullscreenQrCodeCreditsImgSize},
-               {.data = &gHeadingTitleImgData[0], .size = gHeadingTitleImgSize},
-               {.data = &gPickupImgData[0], .size = gPickupImgSize},
-               // {.data = &gNubixLogoImgData[0], .size = gNubixLogoImgSize},
-               {.data = nullptr, .size = 0},
-               {.data = &gHexagonImgData[0], .size = gHexagonImgSize}} {
+    : pack_(AssetPack::load(&gAssetsPackData[0], gAssetsPackSize)),
+      atlas_(nullptr),
+      atlas_users_(0),
+      clock_(0),
+      stats_{} {
   for (int i = static_cast<int>(DILIndex::kStartIndex);
        i < static_cast<int>(DILIndex::kNumDIL); i++) {
-    frameBuffers_[i] = nullptr;
-    current_[i] = 0;
-    callers_[i] = 0;
+    sprites_[i] = {.data = nullptr, .size = 0, .rect = kAssets[i].rect};
+    if (pack_ != nullptr && kAssets[i].name != 0)
+      sprites_[i].data =
+          pack_->find(kAssets[i].name, AssetType::Sprite, sprites_[i].size);
+    surfaces_[i] = nullptr;
+    sizes_[i] = 0;
+    last_used_[i] = 0;
+    pinned_[i] = false;
+  }
+  for (int i = 0; i < static_cast<int>(DILFont::kNumFonts); i++) {
+    uint32_t size = 0;
+    const uint32_t* blob =
+        pack_ != nullptr ? pack_->find(kFontAssets[i], AssetType::Font, size)
+                         : nullptr;
+    fonts_[i] = Font::load(blob, size);
   }
 }
 
@@ -89,65 +132,202 @@ DIL& DIL::GetInstance() {
   return dil;
 }
 
+Sprite* DIL::AcquireAtlas(const Sprites_t& sprite) {
+  if (atlas_ == nullptr) {
+    /* all atlas sprites share the world atlas blob */
+    atlas_ = Sprite::load(sprite.data, sprite.size);
+    if (atlas_ == nullptr) return nullptr;
+  }
+  atlas_users_++;
+  return atlas_;
+}
+
+void DIL::ReleaseAtlas(void) {
+  if (atlas_ == nullptr || --atlas_users_ > 0) return;
+
+  atlas_users_ = 0;
+  delete atlas_;
+  atlas_ = nullptr;
+}
+
 /* so far, this method is used only by the full-screen image */
 void DIL::GetSprite(DILIndex index, FrameView& fb) {
   fb.clear(Color::Opaque);
 
   const Sprites_t& sprite = sprites_[static_cast<int>(index)];
-  PngImage img(sprite.data, sprite.size);
+  Sprite* image = sprite.rect == nullptr
+                      ? Sprite::load(sprite.data, sprite.size)
+                      : AcquireAtlas(sprite);
+  if (image == nullptr) return;
+
+  int width = sprite.rect == nullptr ? image->get_width() : sprite.rect->width;
+  int height =
+      sprite.rect == nullptr ? image->get_height() : sprite.rect->height;
+  int src_x = sprite.rect == nullptr ? 0 : sprite.rect->x;
+  int src_y = sprite.rect == nullptr ? 0 : sprite.rect->y;
+
   // center image
-  img.render(fb, (fb.get_width() - img.widthGet()) / 2,
-             (fb.get_height() - img.heightGet()) / 2);
-}
-
-FrameView* DIL::GetSprite(DILIndex index) {
-  current_[static_cast<int>(index)] = callers_[static_cast<int>(index)];
-
-  if (frameBuffers_[static_cast<int>(index)] == nullptr) {
-    /* here it is better to use stack rather than heap for allocatting,
-     * otherwise we can increase the number of holes on the heap
-     */
-    PngImage img(sprites_[static_cast<int>(index)].data,
-                 sprites_[static_cast<int>(index)].size);
-    // dynamic_cast is disabled via -fno-rtti
-    ///! @todo improve this cast
-    frameBuffers_[static_cast<int>(index)] =
-        static_cast<FrameView*>(img.render());
+  int x = (static_cast<int>(fb.get_width()) - width) / 2;
+  int y = (static_cast<int>(fb.get_height()) - height) / 2;
+  fb.blit(x, y, src_x, src_y, width, height, image);
+
+  if (sprite.rect == nullptr) {
+    delete image;
+  } else {
+    ReleaseAtlas();
   }
+}
 
-  return frameBuffers_[static_cast<int>(index)];
+bool DIL::ShowSprite(DILIndex index) {
+  const Sprites_t& sprite = sprites_[static_cast<int>(index)];
+  if (sprite.rect != nullptr) return false;
+
+  return Sprite::stream(sprite.data, sprite.size, LT177ML35::getInstance(),
+                        Color::Black);
 }
 
-void DIL::ReleaseSprite(DILIndex index) {
-  if (frameBuffers_[static_cast<int>(index)] == nullptr) return;
+uint32_t DIL::Cost(const Sprites_t& sprite) {
+  if (sprite.rect != nullptr || sprite.size < sizeof(SpriteBlob))
+    return sizeof(Sprite);
+
+  const SpriteBlob* header = reinterpret_cast<const SpriteBlob*>(sprite.data);
+  if (header->encoding == 0) return sizeof(Sprite);
+
+  /* encoded pixels are unpacked into word aligned SRAM */
+  PixelFormat format = static_cast<PixelFormat>(header->format);
+  uint32_t bytes =
+      header->width * header->height * Sprite::bytesPerPixel(format);
+  return sizeof(Sprite) + ((bytes + 3) & ~3u);
+}
+
+void DIL::Release(int i) {
+  if (surfaces_[i] == nullptr) return;
+
+  delete surfaces_[i];
+  surfaces_[i] = nullptr;
+  stats_.usage -= sizes_[i];
+  sizes_[i] = 0;
+  if (sprites_[i].rect != nullptr) ReleaseAtlas();
+}
+
+void DIL::Evict(uint32_t bytes) {
+  while (stats_.usage + bytes > kDILBudget) {
+    int oldest = -1;
 
-  if (--current_[static_cast<int>(index)] <= 0) {
-    current_[static_cast<int>(index)] = 0;
-    delete frameBuffers_[static_cast<int>(index)];
-    frameBuffers_[static_cast<int>(index)] = nullptr;
+    for (int i = static_cast<int>(DILIndex::kStartIndex);
+         i < static_cast<int>(DILIndex::kNumDIL); i++) {
+      if (surfaces_[i] == nullptr || pinned_[i]) continue;
+      if (oldest < 0 || last_used_[i] < last_used_[oldest]) oldest = i;
+    }
+
+    /* only pinned sprites left, a sprite larger than the budget still loads */
+    if (oldest < 0) return;
+
+    Release(oldest);
+    stats_.evictions++;
   }
 }
 
-void DIL::ReleaseSpriteForced(DILIndex index) {
-  current_[static_cast<int>(index)] = 0;
-  DIL::ReleaseSprite(index);
+Sprite* DIL::Load(int i, uint32_t bytes) {
+  const Sprites_t& sprite = sprites_[i];
+
+  if (sprite.rect == nullptr) {
+    /* raw sprites stay in flash, only the Sprite object is allocated */
+    surfaces_[i] = Sprite::load(sprite.data, sprite.size);
+  } else {
+    Sprite* atlas = AcquireAtlas(sprite);
+    if (atlas == nullptr) return nullptr;
+    surfaces_[i] = new Sprite(*atlas, *sprite.rect);
+  }
+  if (surfaces_[i] == nullptr) return nullptr;
+
+  sizes_[i] = bytes;
+  last_used_[i] = clock_;
+  stats_.usage += bytes;
+
+  return surfaces_[i];
+}
+
+Sprite* DIL::GetSprite(DILIndex index) {
+  int i = static_cast<int>(index);
+
+  /* sprites without image are drawn procedurally */
+  if (sprites_[i].data == nullptr) return nullptr;
+
+  mutex_enter_blocking(&dil_mutex);
+
+  clock_++;
+  Sprite* sprite = surfaces_[i];
+  if (sprite != nullptr) {
+    stats_.hits++;
+    last_used_[i] = clock_;
+  } else {
+    stats_.misses++;
+    uint32_t bytes = Cost(sprites_[i]);
+    Evict(bytes);
+    sprite = Load(i, bytes);
+  }
+
+  mutex_exit(&dil_mutex);
+
+  return sprite;
+}
+
+void DIL::Prefetch(DILIndex index) {
+  int i = static_cast<int>(index);
+
+  if (index >= DILIndex::kNumDIL || sprites_[i].data == nullptr) return;
+
+  mutex_enter_blocking(&dil_mutex);
+
+  clock_++;
+  if (surfaces_[i] != nullptr) {
+    /* keep it away from eviction until it is drawn */
+    last_used_[i] = clock_;
+  } else {
+    /* never evict here, the drawing core may be blitting the sprite */
+    uint32_t bytes = Cost(sprites_[i]);
+    if (stats_.usage + bytes <= kDILBudget && Load(i, bytes) != nullptr)
+      stats_.prefetches++;
+  }
+
+  mutex_exit(&dil_mutex);
+}
+
+void DIL::ReleaseSprite(DILIndex index) {
+  if (index >= DILIndex::kNumDIL) return;
+
+  mutex_enter_blocking(&dil_mutex);
+  Release(static_cast<int>(index));
+  mutex_exit(&dil_mutex);
+}
+
+void DIL::Pin(DILIndex index, bool pinned) {
+  if (index >= DILIndex::kNumDIL) return;
+
+  mutex_enter_blocking(&dil_mutex);
+  pinned_[static_cast<int>(index)] = pinned;
+  mutex_exit(&dil_mutex);
 }
 
 void DIL::ReleaseAll(void) {
+  mutex_enter_blocking(&dil_mutex);
   for (int i = static_cast<int>(DILIndex::kStartIndex);
        i < static_cast<int>(DILIndex::kNumDIL); i++) {
-    ReleaseSpriteForced(static_cast<DILIndex>(i));
-    current_[i] = 0;
+    if (!pinned_[i]) Release(i);
   }
+  mutex_exit(&dil_mutex);
+
+  /* the PNG decoders are kept between images, give their SRAM back too */
+  PngImage::releaseDecoders();
+}
+
+const Font& DIL::GetFont(DILFont font) const {
+  const Font* loaded = fonts_[static_cast<int>(font)];
+  return loaded != nullptr ? *loaded : kNoFont;
 }
 
 DILIndex DIL::GetFullScreenIndex(DILIndex index) {
   // bypassing the index
   return index;
 }
-
-void DIL::SetNumberOfCallers(DILIndex index, int callers) {
-  if (index >= DILIndex::kNumDIL) return;
-
-  callers_[static_cast<int>(index)] = callers;
-}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * @file Entities.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Store of the world objects and the systems working on them
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include "Entities.hpp"
+
+Entities::Entities() : objects_{} {}
+
+void Entities::Load(const Level &level) {
+  for (int k = 0; k < static_cast<int>(LevelObject::kNumObjects); k++) {
+    LevelObject kind = static_cast<LevelObject>(k);
+
+    objects_[k] = level.GetObjects(kind);
+    level.LoadGrid(kind, grids_[k]);
+  }
+}
+
+void Entities::DrawSprites(LevelObject kind, DILIndex sprite, FrameBuffer *fb,
+                           const Viewport &vp) const {
+  const LevelObjects_t &objects = Get(kind);
+  Sprite *image = nullptr;
+
+  ForEachInArea(
+      kind, vp.GetX(), vp.GetY(), vp.GetWidth(), vp.GetHeight(),
+      [&](int i) {
+        /* looked up when the first entity is visible, so the sprite is not
+         * loaded for nothing */
+        if (image == nullptr) image = DIL::GetInstance().GetSprite(sprite);
+
+        int x = vp.TranslateX(objects.x[i]);
+        int y = vp.TranslateY(objects.y[i]);
+        int cutoff_x = (x < 0) ? -x : 0;
+        int cutoff_y = (y < 0) ? -y : 0;
+        fb->blit(x, y, cutoff_x, cutoff_y, objects.width[i] - cutoff_x,
+                 objects.height[i] - cutoff_y, image);
+      });
+}
+
+void Entities::DrawShapes(LevelObject kind, const BakeShape_t &shape,
+                          FrameBuffer *fb, const Viewport &vp) const {
+  const LevelObjects_t &objects = Get(kind);
+  EntityBox_t box = {-shape.origin_x, -shape.origin_y, shape.width,
+                     shape.height};
+  BakeCache &cache = BakeCache::GetInstance();
+
+  ForEachInArea(kind, box, vp.GetX(), vp.GetY(), vp.GetWidth(),
+                vp.GetHeight(), [&](int i) {
+                  cache.Draw(shape, vp.TranslateX(objects.x[i]),
+                             vp.TranslateY(objects.y[i]), fb);
+                });
+}
@@ -45,18 +45,39 @@
 #include <sensor/Buttons.hpp>
 #include <sensor/GyroAccel.hpp>
 
+#include "BakeCache.hpp"
 #include "FrameView.hpp"
+#include "GameLoop.hpp"
+#include "Snapshot.hpp"
+#include "TileCache.hpp"
 #include "World.hpp"
 
+/**
+ * @brief Everything core1 needs to draw a frame, published by core0 after
+ *     its steps
+ */
+struct FrameState_t {
+  Snake snake;            ///< Snake after the last step
+  uint32_t step_time_us;  ///< Time of the last step, see GameLoop::GetAlpha()
+  WorldState_t world;     ///< Objects after the last step
+};
+
 static FrameView fb_(LT177ML35::getInstance());
-static Viewport vp_(DISP_WIDTH, DISP_HEIGHT);
+static Viewport vp_(DISP_WIDTH, DISP_HEIGHT);  ///< Drawn by core1
+static Viewport prefetch_vp_(DISP_WIDTH, DISP_HEIGHT);  ///< Used by core0
 static State state_ = State::Init;
-static Snake snake_(1264, 9018, Color::Green);  ///< Correct starting point
+static Snake snake_(1264, 9018, Color::Green);  ///< Moved by WorldSpawn()
 // static Snake snake_(4200, 8280, Color::Green);  ///<  Test starting point
 static Action action_ = Action::kKeepRunning;  ///< Global action of the game
+static GameLoop loop_(GAME_STEP_US);  ///< Paces the steps of State::Running
+static Snapshot<FrameState_t> snapshot_(
+    FrameState_t{snake_, 0, {}});  ///< Handed from core0 to core1
+static FrameState_t drawn_{snake_, 0, {}};  ///< Copy core1 draws from
 
 volatile bool pause_thread1_ =
     false;  ///< Variable used to block/unblock the thread1
+volatile bool thread1_paused_ =
+    false;  ///< Set by thread1 while it is blocked by pause_thread1_
 
 static bool isAnyButtonPressed(void) {
   return (Buttons::isPressed(Button::Button_A) ||
@@ -65,28 +86,54 @@ static bool isAnyButtonPressed(void) {
           Buttons::isPressed(Button::Button_D));
 }
 
+/* hands the state after the last step to core1, never waits for it */
+static void Publish(void) {
+  snapshot_.Publish([](FrameState_t& state) {
+    state.snake = snake_;
+    state.step_time_us = loop_.GetStepTime();
+    WorldGetState(state.world);
+  });
+}
+
 static void core1_thread(void) {
   while (1) {
-    while (pause_thread1_)
-      ; /* busy-wait for the popup */
+    while (pause_thread1_) {
+      thread1_paused_ = true;
+      __wfe(); /* sleep until ResumeThread1() */
+    }
+
+    /* core0 keeps stepping meanwhile, the frame only uses the copy */
+    snapshot_.Read(drawn_);
+
+    /* draw between the last two steps, so the snake moves smoothly whatever
+     * the frame rate is */
+    Fixed_t alpha = loop_.GetAlpha(drawn_.step_time_us);
+    Position_t head = drawn_.snake.Interpolate(alpha);
+    vp_.UpdateCenter(head.x, head.y);
 
     fb_.clear(kSnakeBackgroundColor);
 
-    WorldDraw(&fb_);
-    snake_.Draw(fb_);
+    WorldDraw(&fb_, drawn_.world);
+    drawn_.snake.Draw(fb_, alpha);
 
-    fb_.show(false);
+    fb_.show(true);
   }
 }
 
 static void Init(void) {
   LT177ML35::getInstance().setBrightness(100);
+  LT177ML35::getInstance().setFrameRate(GAME_FRAME_RATE);
   fb_.set_viewport(&vp_);
   fb_.clear(kSnakeBackgroundColor);
   fb_.show(false);
 
   Buttons::init();
   WorldInit();
+  WorldSpawn(snake_);
+
+  /* sizes the vectors of drawn_ here, core1 copies without allocating */
+  Publish();
+  snapshot_.Read(drawn_);
 
   state_ = State::Startup;
 }
@@ -95,8 +142,8 @@ static void Startup(void) {
   vp_.UpdateCenter(snake_.GetPosition().GetX(), snake_.GetPosition().GetY());
 
   fb_.clear(kSnakeBackgroundColor);
-  WorldDraw(&fb_);
-  snake_.Draw(fb_);
+  WorldDraw(&fb_, drawn_.world);
+  drawn_.snake.Draw(fb_);
   fb_.show(false);
 
   /* wait user press any button */
@@ -111,13 +158,12 @@ static void Startup(void) {
   multicore_launch_core1(core1_thread);
 }
 
-static void Running(void) {
+/* one simulation step of GAME_STEP_US, the viewport follows in core1_thread */
+static void Step(void) {
   if (Buttons::isPressed(Button::Button_C)) snake_.Turn(SnakeTurn::Turn_LEFT);
 
   if (Buttons::isPressed(Button::Button_D)) snake_.Turn(SnakeTurn::Turn_RIGHT);
 
-  vp_.UpdateCenter(snake_.GetPosition().GetX(), snake_.GetPosition().GetY());
-
   action_ = WorldUpdate(&fb_, snake_.GetParticle());
 
   switch (action_) {
@@ -141,6 +187,21 @@ static void Running(void) {
   snake_.Update();
 }
 
+static void Running(void) {
+  /* as many steps as the time since the last ones makes up, the game runs at
+   * the same speed however long core1 takes for a frame */
+  int steps = loop_.Advance();
+  if (steps == 0) return;
+
+  for (; steps > 0 && state_ == State::Running; steps--) Step();
+  Publish();
+
+  /* core0 idles until the next step, load what core1 will draw next */
+  prefetch_vp_.UpdateCenter(snake_.GetPosition().GetX(),
+                            snake_.GetPosition().GetY());
+  WorldPrefetch(&prefetch_vp_, snake_.GetParticle());
+}
+
 static DILIndex TranslateActionToDILIndex(Action action) {
   switch (action) {
     case Action::kPickupFlash:
@@ -158,31 +219,50 @@ static DILIndex TranslateActionToDILIndex(Action action) {
   }
 }
 
-static void Popup(bool run_forever = false) {
+/* returns when thread1 finished its frame, afterwards the display is free */
+static void PauseThread1(void) {
+  if (pause_thread1_) return; /* e.g. Popup() of Source() */
+
+  thread1_paused_ = false;
   pause_thread1_ = true;
+  while (!thread1_paused_) tight_loop_contents();
+}
 
-  DIL::GetInstance().ReleaseAll();
+static void ResumeThread1(void) {
+  pause_thread1_ = false;
+  __sev();
+}
 
-  /* wait user press any button */
-  while (!isAnyButtonPressed() || run_forever) {
-    fb_.clear(Color::Black);
+static void Popup(bool run_forever = false) {
+  PauseThread1();
+
+  DIL::GetInstance().ReleaseAll();
+  BakeCache::GetInstance().Clear();
+  TileCache::GetInstance().Clear();
 
-    // TODO::check if we need to keep the TranslateActionToDILIndex() func
-    DIL::GetInstance().GetSprite(TranslateActionToDILIndex(action_), fb_);
+  // TODO::check if we need to keep the TranslateActionToDILIndex() func
+  DILIndex index = TranslateActionToDILIndex(action_);
 
+  /* the image stays on the display until thread1 draws again */
+  if (!DIL::GetInstance().ShowSprite(index)) {
+    DIL::GetInstance().GetSprite(index, fb_);
     fb_.show(true);
   }
 
+  /* wait user press any button */
+  while (!isAnyButtonPressed() || run_forever) {
+    // do nothing
+  }
+
   state_ = State::Running;
 
-  pause_thread1_ = false;
+  ResumeThread1();
 }
 
 static void Source(void) {
-  pause_thread1_ = true;
-  sleep_ms(100);
+  PauseThread1();
 
-  Font font{Azaret_small_WIDTH, Azaret_small_HEIGHT, &Azaret_smallData[0]};
+  const Font& font = DIL::GetInstance().GetFont(DILFont::kAzaretSmall);
   fb_.clear(Color::Black);
 
   size_t y = (fb_.get_height() >> 1) - font.getHeight();
@@ -204,17 +284,19 @@ static void Source(void) {
   Popup(false);
 
   state_ = State::Running;
-  pause_thread1_ = false;
+  ResumeThread1();
 }
 
 static void Sensor(void) {
-  pause_thread1_ = true;
+  PauseThread1();
   DIL::GetInstance().ReleaseAll();
+  BakeCache::GetInstance().Clear();
+  TileCache::GetInstance().Clear();
 
 #define TEXT_SIZE (20)
   GyroAccel gyro;
   char text[TEXT_SIZE] = {0};
-  Font font{Azaret_small_WIDTH, Azaret_small_HEIGHT, &Azaret_smallData[0]};
+  const Font& font = DIL::GetInstance().GetFont(DILFont::kAzaretSmall);
 
   gyro.initialize();
   gyro.calibrate();
@@ -252,14 +334,13 @@ static void Sensor(void) {
   }
 
   state_ = State::Running;
-  pause_thread1_ = false;
+  ResumeThread1();
 }
 
 static void Credits(void) {
-  pause_thread1_ = true;
-  sleep_ms(100);
+  PauseThread1();
 
-  Font font{Azaret_small_WIDTH, Azaret_small_HEIGHT, &Azaret_smallData[0]};
+  const Font& font = DIL::GetInstance().GetFont(DILFont::kAzaretSmall);
   /* end of game screen */
   {
     fb_.clear(Color::Black);
@@ -330,13 +411,11 @@ static void Credits(void) {
 
   state_ = State::QrCodeCredits;
 
-  pause_thread1_ = false;
+  ResumeThread1();
 }
 
 void GameRun(void) {
-  uint32_t start = time_us_32();
-  uint32_t end;
-  int32_t delay = INT32_MAX;
+  State state = state_;
 
   switch (state_) {
     case State::Init:
@@ -373,8 +452,12 @@ void GameRun(void) {
       break;
   }
 
-  do {
-    end = time_us_32();
-    delay = GAME_FPS_PERIOD_US - (end - start);
-  } while (delay > 0);
+  if (state_ != State::Running) {
+    LT177ML35::getInstance().waitForVSync();
+    return;
+  }
+
+  /* the time spent in the other states is not simulated */
+  if (state != State::Running) loop_.Reset();
+  loop_.Sleep();
 }
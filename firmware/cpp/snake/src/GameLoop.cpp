@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * @file GameLoop.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Fixed simulation step of the game, decoupled from drawing
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include "GameLoop.hpp"
+
+#include <hardware/sync.h>
+#include <hardware/timer.h>
+
+/**
+ * @brief Wakes up the core sleeping in GameLoop::Sleep()
+ */
+static void OnAlarm(uint /*alarm*/) { __sev(); }
+
+GameLoop::GameLoop(uint32_t step_us)
+    : step_us_(step_us), last_step_us_(0), alarm_(-1) {}
+
+void GameLoop::Reset(void) { last_step_us_ = time_us_32(); }
+
+int GameLoop::Advance(void) {
+  uint32_t now = time_us_32();
+  uint32_t steps = (now - last_step_us_) / step_us_;
+
+  /* too far behind, e.g. a frame took very long: rather slow down than
+   * simulate a burst of steps at once */
+  if (steps > kGameLoopMaxSteps) {
+    last_step_us_ = now - kGameLoopMaxSteps * step_us_;
+    steps = kGameLoopMaxSteps;
+  }
+
+  last_step_us_ = last_step_us_ + steps * step_us_;
+  return static_cast<int>(steps);
+}
+
+Fixed_t GameLoop::GetAlpha(uint32_t step_time_us) const {
+  uint32_t elapsed = time_us_32() - step_time_us;
+
+  if (elapsed >= step_us_) return kFixedOne;
+  return static_cast<Fixed_t>((static_cast<uint64_t>(elapsed) << kFixedShift) /
+                              step_us_);
+}
+
+void GameLoop::Sleep(void) {
+  uint32_t next = last_step_us_ + step_us_;
+  int32_t remaining = static_cast<int32_t>(next - time_us_32());
+
+  if (remaining <= 0) return;
+
+  if (alarm_ < 0) {
+    alarm_ = hardware_alarm_claim_unused(false);
+    if (alarm_ >= 0) hardware_alarm_set_callback(alarm_, OnAlarm);
+  }
+
+  /* without alarm, or when the step is already due, there is no sleep */
+  if (alarm_ < 0 ||
+      hardware_alarm_set_target(alarm_,
+                                delayed_by_us(get_absolute_time(), remaining)))
+    return;
+
+  /* other interrupts, e.g. TE, wake up the core too */
+  while (static_cast<int32_t>(next - time_us_32()) > 0) __wfe();
+}
@@ -44,7 +44,7 @@
 #define HEADLINE_COLOR (Color::White)  ///< Headline color
 
 Headline::Headline()
-    : font_{Azaret_large_WIDTH, Azaret_large_HEIGHT, &Azaret_largeData[0]},
+    : font_(DIL::GetInstance().GetFont(DILFont::kAzaretLarge)),
       color_(HEADLINE_COLOR) {}
 
 Headline::~Headline() {}
@@ -63,9 +63,9 @@ void Headline::SetHeadline(const char *index, const char *headline) {
   strncpy(text_[pos++], headline, TEXT_MAX_LENGTH - 1);
 }
 
-void Headline::Draw(int x, int y, FrameView *fb) {
+void Headline::Draw(int x, int y, FrameBuffer *fb) {
   fb->text(x, y, text_[0], font_, color_, Color::Opaque);
   fb->text(x, y + 20, text_[1], font_, color_, Color::Opaque);
 }
 
-Font &Headline::GetFont(void) { return font_; }
+const Font &Headline::GetFont(void) const { return font_; }
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * @file Level.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Levels loaded in place from a blob in flash
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include "Level.hpp"
+
+#include <cstring>
+
+/**
+ * @brief Checks that @p bytes at @p offset are inside of a blob of @p size
+ *     and aligned to @p align
+ */
+static bool IsInside(uint32_t offset, uint32_t bytes, uint32_t size,
+                     uint32_t align) {
+  return (offset % align) == 0 && offset <= size && bytes <= size - offset;
+}
+
+Level::Level() : base_(nullptr), header_(nullptr) {}
+
+bool Level::Load(const uint32_t* blob, uint32_t size) {
+  base_ = nullptr;
+  header_ = nullptr;
+  if (blob == nullptr || size < sizeof(LevelBlob_t)) return false;
+
+  const LevelBlob_t* header = reinterpret_cast<const LevelBlob_t*>(blob);
+  const uint8_t* base = reinterpret_cast<const uint8_t*>(blob);
+  if (header->magic != kLevelMagic || header->version != kLevelVersion)
+    return false;
+  if (header->size > size) return false;
+  size = header->size;
+
+  uint32_t tables = header->tables * sizeof(LevelTable_t);
+  uint32_t walls = header->walls * sizeof(LevelWall_t);
+  if (!IsInside(sizeof(LevelBlob_t), tables + walls, size, 4)) return false;
+
+  /* only the offsets are checked, the objects are used as they are */
+  const LevelTable_t* table = reinterpret_cast<const LevelTable_t*>(header + 1);
+  for (int i = 0; i < header->tables; i++, table++) {
+    if (!IsInside(table->x, table->count * sizeof(int16_t), size, 2) ||
+        !IsInside(table->y, table->count * sizeof(int16_t), size, 2) ||
+        !IsInside(table->width, table->count, size, 1) ||
+        !IsInside(table->height, table->count, size, 1))
+      return false;
+    /* the state of coins and texts is kept in fixed bit arrays */
+    if ((i == static_cast<int>(LevelObject::kCollectables) &&
+         table->count > kLevelMaxCoins) ||
+        (i == static_cast<int>(LevelObject::kFadingTextAreas) &&
+         table->count > kLevelMaxTexts))
+      return false;
+    if (table->grid != 0 && !IsInside(table->grid, sizeof(SpatialGridBlob_t),
+                                      size, 2))
+      return false;
+    if (table->texts == 0) continue;
+    if (!IsInside(table->texts, table->count * sizeof(uint32_t), size, 4))
+      return false;
+
+    const uint32_t* texts =
+        reinterpret_cast<const uint32_t*>(base + table->texts);
+    for (int t = 0; t < table->count; t++) {
+      if (texts[t] == 0) continue;
+      if (texts[t] >= size ||
+          memchr(base + texts[t], '\0', size - texts[t]) == nullptr)
+        return false;
+    }
+  }
+
+  const LevelWall_t* wall = reinterpret_cast<const LevelWall_t*>(table);
+  for (int i = 0; i < header->walls; i++, wall++) {
+    if (!IsInside(wall->points, wall->count * sizeof(LevelPoint_t), size, 2))
+      return false;
+  }
+
+  base_ = base;
+  header_ = header;
+  return true;
+}
+
+const LevelTable_t* Level::GetTable(LevelObject kind) const {
+  int i = static_cast<int>(kind);
+
+  if (header_ == nullptr || i < 0 || i >= header_->tables) return nullptr;
+  return reinterpret_cast<const LevelTable_t*>(header_ + 1) + i;
+}
+
+int Level::GetCount(LevelObject kind) const {
+  const LevelTable_t* table = GetTable(kind);
+
+  return table != nullptr ? table->count : 0;
+}
+
+LevelObjects_t Level::GetObjects(LevelObject kind) const {
+  const LevelTable_t* table = GetTable(kind);
+
+  if (table == nullptr || table->count == 0)
+    return LevelObjects_t{nullptr, nullptr, nullptr, nullptr, 0};
+  return LevelObjects_t{
+      reinterpret_cast<const int16_t*>(base_ + table->x),
+      reinterpret_cast<const int16_t*>(base_ + table->y),
+      base_ + table->width, base_ + table->height, table->count};
+}
+
+const char* Level::GetText(LevelObject kind, int i) const {
+  const LevelTable_t* table = GetTable(kind);
+
+  if (table == nullptr || table->texts == 0 || i < 0 || i >= table->count)
+    return "";
+
+  uint32_t offset = reinterpret_cast<const uint32_t*>(base_ + table->texts)[i];
+  return offset != 0 ? reinterpret_cast<const char*>(base_ + offset) : "";
+}
+
+void Level::LoadGrid(LevelObject kind, SpatialGrid& grid) const {
+  const LevelTable_t* table = GetTable(kind);
+
+  if (table != nullptr && table->grid != 0 &&
+      grid.Load(reinterpret_cast<const SpatialGridBlob_t*>(base_ + table->grid),
+                header_->size - table->grid, table->count))
+    return;
+
+  LevelObjects_t objects = GetObjects(kind);
+  grid.Build(objects.x, objects.y, objects.width, objects.height,
+             objects.count);
+}
+
+int Level::GetWallCount(void) const {
+  return header_ != nullptr ? header_->walls : 0;
+}
+
+const LevelPoint_t* Level::GetWall(int i, int& count) const {
+  count = 0;
+  if (i < 0 || i >= GetWallCount()) return nullptr;
+
+  const LevelTable_t* tables =
+      reinterpret_cast<const LevelTable_t*>(header_ + 1);
+  const LevelWall_t* wall =
+      reinterpret_cast<const LevelWall_t*>(tables + header_->tables) + i;
+  count = wall->count;
+  return reinterpret_cast<const LevelPoint_t*>(base_ + wall->points);
+}
+
+LevelPoint_t Level::GetSpawn(void) const {
+  return header_ != nullptr ? header_->spawn : LevelPoint_t{0, 0};
+}
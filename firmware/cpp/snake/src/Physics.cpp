@@ -36,92 +36,189 @@
  *******************************************************************************/
 #include "Physics.hpp"
 
-#include <cmath>
+#define kSinShift (30)  ///< Fraction bits of the sine table
+
+/**
+ * @brief Sine of x in [0, pi / 2] as Taylor series, for the table only
+ */
+static constexpr double TaylorSin(double x) {
+  double term = x;
+  double sum = x;
+
+  for (int k = 1; k < 12; k++) {
+    term *= -x * x / ((2 * k) * (2 * k + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+/**
+ * @brief Sine of a quarter turn in Q2.30, one entry per Angle_t
+ *     Computed by the compiler, so the firmware has the table in flash and
+ *     uses no floating point. The high precision keeps the length of a vector
+ *     when it is turned over and over, see Vector::Rotate().
+ */
+struct SinTable_t {
+  int32_t values[kAngleQuarter + 1];
+
+  constexpr SinTable_t() : values() {
+    for (int i = 0; i <= kAngleQuarter; i++)
+      values[i] = static_cast<int32_t>(
+          TaylorSin(3.14159265358979323846 / 2 * i / kAngleQuarter) *
+              (1 << kSinShift) +
+          0.5);
+  }
+};
+
+static constexpr SinTable_t kSinTable;
+
+/**
+ * @brief Square root of a 64 bit number, bit by bit
+ */
+static uint32_t SquareRoot(uint64_t value) {
+  uint64_t root = 0;
+  uint64_t bit = 1ull << 62;
+
+  while (bit > value) bit >>= 2;
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else
+      root >>= 1;
+    bit >>= 2;
+  }
 
-Vector::Vector() {
-  x_ = 1;
-  y_ = 1;
-  angle_ = GetAngle();
+  return static_cast<uint32_t>(root);
 }
 
-Vector::Vector(float x, float y) : x_(x), y_(y) { angle_ = GetAngle(); }
+/**
+ * @brief Sine in Q2.30
+ */
+static int32_t PreciseSin(Angle_t angle) {
+  int quadrant = (angle / kAngleQuarter) & 3;
+  int step = angle & (kAngleQuarter - 1);
 
-Vector::~Vector() {}
+  /* the second and fourth quarter mirror the first one */
+  if (quadrant & 1) step = kAngleQuarter - step;
 
-Vector Vector::operator=(const Vector& other) {
-  if (this != &other) {
-    x_ = other.x_;
-    y_ = other.y_;
-    angle_ = other.angle_;
-  }
-  return *this;
+  int32_t value = kSinTable.values[step];
+  return (quadrant & 2) ? -value : value;
+}
+
+/**
+ * @brief Cosine in Q2.30
+ */
+static int32_t PreciseCos(Angle_t angle) {
+  return PreciseSin(static_cast<Angle_t>(angle + kAngleQuarter));
+}
+
+/**
+ * @brief Converts a product of a Fixed_t and a Q2.30 factor back, rounded
+ */
+static Fixed_t FromPrecise(int64_t product) {
+  return static_cast<Fixed_t>((product + (1 << (kSinShift - 1))) >>
+                              kSinShift);
+}
+
+Fixed_t Sin(Angle_t angle) {
+  constexpr int kShift = kSinShift - kFixedShift;
+
+  return (PreciseSin(angle) + (1 << (kShift - 1))) >> kShift;
+}
+
+Fixed_t Cos(Angle_t angle) {
+  return Sin(static_cast<Angle_t>(angle + kAngleQuarter));
 }
 
-void Vector::SetLength(float length) {
-  angle_ = GetAngle();
+Vector::Vector() : x_(kFixedOne), y_(kFixedOne) {}
 
-  x_ = length * std::cos(angle_);
-  y_ = length * std::sin(angle_);
+Vector::Vector(int x, int y) : x_(ToFixed(x)), y_(ToFixed(y)) {}
+
+Vector Vector::FromFixed(Fixed_t x, Fixed_t y) {
+  Vector vector;
+
+  vector.x_ = x;
+  vector.y_ = y;
+  return vector;
+}
+
+void Vector::SetLength(Fixed_t length) {
+  Fixed_t current = GetLength();
+
+  if (current == 0) {
+    x_ = length;
+    y_ = 0;
+    return;
+  }
+
+  x_ = static_cast<Fixed_t>(static_cast<int64_t>(x_) * length / current);
+  y_ = static_cast<Fixed_t>(static_cast<int64_t>(y_) * length / current);
 }
 
-void Vector::SetAngle(float angle) {
-  float length = GetLength();
+void Vector::SetAngle(Angle_t angle) {
+  Fixed_t length = GetLength();
 
-  x_ = length * std::cos(angle);
-  y_ = length * std::sin(angle);
+  x_ = FromPrecise(static_cast<int64_t>(length) * PreciseCos(angle));
+  y_ = FromPrecise(static_cast<int64_t>(length) * PreciseSin(angle));
 }
 
-float Vector::GetLength() { return std::sqrt(x_ * x_ + y_ * y_); }
+void Vector::Rotate(Angle_t angle) {
+  int64_t cos = PreciseCos(angle);
+  int64_t sin = PreciseSin(angle);
+  int64_t x = x_;
+  int64_t y = y_;
 
-float Vector::GetAngle() { return std::atan2(y_, x_); }
+  x_ = FromPrecise(x * cos - y * sin);
+  y_ = FromPrecise(x * sin + y * cos);
+}
 
-float Vector::GetX() { return x_; }
+Fixed_t Vector::GetLength() const {
+  return static_cast<Fixed_t>(SquareRoot(GetLengthSquared()));
+}
 
-float Vector::GetY() { return y_; }
+int64_t Vector::GetLengthSquared() const {
+  return static_cast<int64_t>(x_) * x_ + static_cast<int64_t>(y_) * y_;
+}
 
-Vector& Vector::AddTo(Vector& vector) {
-  x_ += vector.GetX();
-  y_ += vector.GetY();
+Vector& Vector::AddTo(const Vector& vector) {
+  x_ += vector.x_;
+  y_ += vector.y_;
 
   return *this;
 }
 
-Vector& Vector::SubtractFrom(Vector& vector) {
-  x_ -= vector.GetX();
-  y_ -= vector.GetY();
+Vector& Vector::SubtractFrom(const Vector& vector) {
+  x_ -= vector.x_;
+  y_ -= vector.y_;
 
   return *this;
 }
 
 Vector& Vector::Reverse() {
-  x_ *= -1;
-  y_ *= -1;
-  angle_ = GetAngle();
+  x_ = -x_;
+  y_ = -y_;
 
   return *this;
 }
 
 Vector& Vector::ReverseX() {
-  x_ *= -1;
-  angle_ = GetAngle();
+  x_ = -x_;
 
   return *this;
 }
 
 Vector& Vector::ReverseY() {
-  y_ *= -1;
-  angle_ = GetAngle();
+  y_ = -y_;
 
   return *this;
 }
 
-Particle::Particle(float x, float y) : position_(x, y) {}
-
-Particle::~Particle() {}
+Particle::Particle(int x, int y) : mass_(0), position_(x, y) {}
 
 void Particle::SetMass(int mass) { mass_ = mass; }
 
-int Particle::GetMass() { return mass_; }
+int Particle::GetMass() const { return mass_; }
 
 Vector& Particle::GetPosition() { return position_; }
 
@@ -129,32 +226,44 @@ Vector& Particle::GetVelocity() { return velocity_; }
 
 void Particle::Update() { position_.AddTo(velocity_); }
 
-float Particle::DistanceTo(Particle& particle) {
-  Vector& vec = particle.GetPosition();
-
-  float dx = vec.GetX() - this->position_.GetX();
-  float dy = vec.GetY() - this->position_.GetY();
+Fixed_t Particle::DistanceTo(const Particle& particle) const {
+  Vector distance = particle.position_;
 
-  return std::sqrt(dx * dx + dy * dy);
+  distance.SubtractFrom(position_);
+  return distance.GetLength();
 }
 
-void Particle::GravitateTo(Particle& particle) {
-  Vector gravity(1, 0);
-  float distance = DistanceTo(particle);
+int64_t Particle::DistanceSquaredTo(int x, int y) const {
+  Vector distance(x, y);
 
-  float force = static_cast<float>(particle.GetMass() / (distance * distance));
-
-  if (force > 3) force = 3;
-
-  gravity.SetLength(force);
-  gravity.SetAngle(AngleTo(particle));
-
-  velocity_.AddTo(gravity);
+  distance.SubtractFrom(position_);
+  return distance.GetLengthSquared();
 }
 
-float Particle::AngleTo(Particle& particle) {
-  Vector& vec = particle.GetPosition();
+#define kGravityMaxForce (3)  ///< Limit of the pull of GravitateTo()
+
+void Particle::GravitateTo(const Particle& particle) {
+  Vector distance = particle.position_;
+  distance.SubtractFrom(position_);
+
+  /* force = mass / distance^2, towards the particle; all squared values are
+   * Q32.32 */
+  int64_t distance_squared = distance.GetLengthSquared();
+  int64_t mass = static_cast<int64_t>(particle.GetMass()) << (2 * kFixedShift);
+  Fixed_t force = ToFixed(kGravityMaxForce);
+  if (mass == 0)
+    force = 0;
+  else if (mass < kGravityMaxForce * distance_squared)
+    force = static_cast<Fixed_t>(mass / (distance_squared >> kFixedShift));
+
+  Fixed_t length = distance.GetLength();
+  if (length == 0) {
+    velocity_.x_ += force;
+    return;
+  }
 
-  return std::atan2(vec.GetY() - position_.GetY(),
-                    vec.GetX() - position_.GetX());
+  velocity_.x_ += static_cast<Fixed_t>(
+      static_cast<int64_t>(distance.x_) * force / length);
+  velocity_.y_ += static_cast<Fixed_t>(
+      static_cast<int64_t>(distance.y_) * force / length);
 }
@@ -36,16 +36,19 @@
  *******************************************************************************/
 #include "Snake.hpp"
 
-#define kDeltaAngle ((4 * M_PI) / 180)  ///< The step-angle that snakes rotate
+#define kDeltaAngle (ToAngle(4))  ///< The step-angle that snakes rotate
 #define kTailPush \
   (5)  ///< How many time to push a new entry into the snake's tail
 #define kTailAlphaDecay \
   (40)  ///< Alpha decay factor to draw the tail of the snake
 #define kSnakeHeadRadius (3)       ///< Radius of the snake's head
 #define kSnakeTailRadius (2)       ///< Radius of the snake's tail
-#define kSnakeDefaultSpeed (1.0f)  ///< Speed of the snake
+#define kSnakeDefaultSpeed (ToFixed(1))  ///< Speed of the snake
+#define kSnakeSpeedStep \
+  (ToFixed(0.1))  ///< Speed change per update towards kSnakeDefaultSpeed
 
-Snake::Snake(int x, int y, Color color) : particle_(x, y), color_(color) {
+Snake::Snake(int x, int y, Color color)
+    : particle_(x, y), previous_(x, y), color_(color) {
   for (int i = 0; i < kTailSize; i++) {
     tailTrace_[i].x = x;
     tailTrace_[i].y = y;
@@ -54,7 +57,7 @@ Snake::Snake(int x, int y, Color color) : particle_(x, y), color_(color) {
   particle_.GetVelocity().SetLength(kSnakeDefaultSpeed);
 
   /* set the starting direction of the velocity (going up) */
-  particle_.GetVelocity().SetAngle(-(90 * M_PI / 180));
+  particle_.GetVelocity().SetAngle(ToAngle(-90));
 }
 
 void Snake::ClearTail() {
@@ -64,6 +67,12 @@ void Snake::ClearTail() {
   }
 }
 
+void Snake::MoveTo(int x, int y) {
+  particle_.GetPosition() = Vector(x, y);
+  previous_ = particle_.GetPosition();
+  ClearTail();
+}
+
 void Snake::PushTailPosition() {
   tailTrace_[head_].x = particle_.GetPosition().GetX();
   tailTrace_[head_].y = particle_.GetPosition().GetY();
@@ -81,13 +90,19 @@ void Snake::Update() {
     PushTailPosition();
   }
 
-  float velocity = particle_.GetVelocity().GetLength();
+  Fixed_t velocity = particle_.GetVelocity().GetLength();
+  Fixed_t error = velocity - kSnakeDefaultSpeed;
 
-  if (velocity > kSnakeDefaultSpeed)
-    particle_.GetVelocity().SetLength(velocity - 0.1);
-  if (velocity < kSnakeDefaultSpeed)
-    particle_.GetVelocity().SetLength(velocity + 0.1);
+  /* the last step snaps to the default speed, instead of oscillating around
+   * it */
+  if (error > kSnakeSpeedStep)
+    particle_.GetVelocity().SetLength(velocity - kSnakeSpeedStep);
+  else if (error < -kSnakeSpeedStep)
+    particle_.GetVelocity().SetLength(velocity + kSnakeSpeedStep);
+  else if (error != 0)
+    particle_.GetVelocity().SetLength(kSnakeDefaultSpeed);
 
+  previous_ = particle_.GetPosition();
   particle_.Update();
 }
 
@@ -126,23 +141,28 @@ void Snake::DrawTail(FrameView &fb) {
   }
 }
 
-void Snake::Draw(FrameView &fb) {
+void Snake::Draw(FrameView &fb, Fixed_t alpha) {
   Viewport *vp = fb.get_viewport();
 
   if (vp == nullptr) return;
 
-  fb.circle_filled2(vp->TranslateX(particle_.GetPosition().GetX()),
-                    vp->TranslateY(particle_.GetPosition().GetY()),
+  Position_t head = Interpolate(alpha);
+  fb.circle_filled2(vp->TranslateX(head.x), vp->TranslateY(head.y),
                     kSnakeHeadRadius, kSnakeBaseColor);
 
   DrawTail(fb);
 }
 
 void Snake::Turn(SnakeTurn turn) {
-  float angle = particle_.GetVelocity().GetAngle();
+  particle_.GetVelocity().Rotate(
+      (SnakeTurn::Turn_RIGHT == turn) ? kDeltaAngle : -kDeltaAngle);
+}
+
+Position_t Snake::Interpolate(Fixed_t alpha) {
+  Vector &position = particle_.GetPosition();
 
-  angle += (SnakeTurn::Turn_RIGHT == turn) ? kDeltaAngle : -kDeltaAngle;
-  particle_.GetVelocity().SetAngle(angle);
+  return {ToInt(previous_.x_ + FixedMul(position.x_ - previous_.x_, alpha)),
+          ToInt(previous_.y_ + FixedMul(position.y_ - previous_.y_, alpha))};
 }
 
 Particle &Snake::GetParticle() { return particle_; }
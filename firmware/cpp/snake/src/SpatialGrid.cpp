@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * @file SpatialGrid.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Uniform grid index over the positions of world objects
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include "SpatialGrid.hpp"
+
+#include <climits>
+#include <cstring>
+
+SpatialGrid::SpatialGrid()
+    : x0_(0),
+      y0_(0),
+      columns_(0),
+      rows_(0),
+      cell_(kSpatialGridCell),
+      max_width_(0),
+      max_height_(0),
+      starts_(nullptr),
+      items_(nullptr),
+      owned_(false) {}
+
+SpatialGrid::~SpatialGrid() { Release(); }
+
+void SpatialGrid::Release(void) {
+  if (owned_) {
+    delete[] starts_;
+    delete[] items_;
+  }
+  starts_ = nullptr;
+  items_ = nullptr;
+  owned_ = false;
+  columns_ = 0;
+  rows_ = 0;
+}
+
+uint16_t* SpatialGrid::Allocate(int x_min, int y_min, int x_max, int y_max,
+                                int count, uint16_t** items) {
+  Release();
+  if (count <= 0) return nullptr;
+
+  x0_ = x_min;
+  y0_ = y_min;
+  cell_ = kSpatialGridCell;
+  columns_ = (x_max - x_min) / cell_ + 1;
+  rows_ = (y_max - y_min) / cell_ + 1;
+
+  uint16_t* starts = new uint16_t[columns_ * rows_ + 1];
+  memset(starts, 0, (columns_ * rows_ + 1) * sizeof(uint16_t));
+  *items = new uint16_t[count];
+  starts_ = starts;
+  items_ = *items;
+  owned_ = true;
+  return starts;
+}
+
+void SpatialGrid::Build(const int16_t* x, const int16_t* y,
+                        const uint8_t* width, const uint8_t* height,
+                        int count) {
+  int x_min = INT_MAX, y_min = INT_MAX, x_max = INT_MIN, y_max = INT_MIN;
+
+  max_width_ = 0;
+  max_height_ = 0;
+  for (int i = 0; i < count; i++) {
+    if (x[i] < x_min) x_min = x[i];
+    if (y[i] < y_min) y_min = y[i];
+    if (x[i] > x_max) x_max = x[i];
+    if (y[i] > y_max) y_max = y[i];
+    if (width[i] > max_width_) max_width_ = width[i];
+    if (height[i] > max_height_) max_height_ = height[i];
+  }
+  uint16_t* items;
+  uint16_t* starts = Allocate(x_min, y_min, x_max, y_max, count, &items);
+  if (starts == nullptr) return;
+
+  /* counting sort by cell: count, sum up, place, shift back to the start */
+  for (int i = 0; i < count; i++)
+    starts[Row(y[i]) * columns_ + Column(x[i]) + 1]++;
+  for (int c = 0; c < columns_ * rows_; c++) starts[c + 1] += starts[c];
+  for (int i = 0; i < count; i++)
+    items[starts[Row(y[i]) * columns_ + Column(x[i])]++] =
+        static_cast<uint16_t>(i);
+  for (int c = columns_ * rows_; c > 0; c--) starts[c] = starts[c - 1];
+  starts[0] = 0;
+}
+
+bool SpatialGrid::Load(const SpatialGridBlob_t* blob, uint32_t size,
+                       int count) {
+  Release();
+  if (blob == nullptr || size < sizeof(SpatialGridBlob_t)) return false;
+  if (blob->columns == 0 || blob->rows == 0 || blob->cell == 0) return false;
+  if (count < 0 || count > UINT16_MAX) return false;
+
+  uint32_t cells = static_cast<uint32_t>(blob->columns) * blob->rows;
+  if (sizeof(SpatialGridBlob_t) + (cells + 1 + count) * sizeof(uint16_t) >
+      size)
+    return false;
+
+  /* the queries trust the cells, so a broken grid is not used at all */
+  const uint16_t* starts = reinterpret_cast<const uint16_t*>(blob + 1);
+  const uint16_t* items = starts + cells + 1;
+  if (starts[0] != 0 || starts[cells] != count) return false;
+  for (uint32_t c = 0; c < cells; c++)
+    if (starts[c] > starts[c + 1]) return false;
+  for (int i = 0; i < count; i++)
+    if (items[i] >= count) return false;
+
+  x0_ = blob->x0;
+  y0_ = blob->y0;
+  columns_ = blob->columns;
+  rows_ = blob->rows;
+  cell_ = blob->cell;
+  max_width_ = blob->max_width;
+  max_height_ = blob->max_height;
+  starts_ = starts;
+  items_ = items;
+  return true;
+}
+
+int SpatialGrid::Column(int x) const {
+  if (x <= x0_) return 0;
+  int column = (x - x0_) / cell_;
+  return column < columns_ ? column : columns_ - 1;
+}
+
+int SpatialGrid::Row(int y) const {
+  if (y <= y0_) return 0;
+  int row = (y - y0_) / cell_;
+  return row < rows_ ? row : rows_ - 1;
+}
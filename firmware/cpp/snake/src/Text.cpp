@@ -107,31 +107,13 @@ void Text::Draw(FrameView *fb, Color color, int x, int y) {
   (void)y;
   for (int i = 0; i < this->n_lines_; i++) {
     if (size_ == TextSize::Small) {
-      Font font{Azaret_small_WIDTH, Azaret_small_HEIGHT, &Azaret_smallData[0]};
+      const Font& font = DIL::GetInstance().GetFont(DILFont::kAzaretSmall);
       fb->text(5, 15 + i * 13, text_[i], font, color, Color::Opaque);
     } else {
-      Font font{Azaret_large_WIDTH, Azaret_large_HEIGHT, &Azaret_largeData[0]};
+      const Font& font = DIL::GetInstance().GetFont(DILFont::kAzaretLarge);
       fb->text(5, 15 + i * 13, text_[i], font, color, Color::Opaque);
     }
   }
 }
 
 void Text::SetSize(TextSize size) { size_ = size; }
-
-bool Text::IsVisible(int x, int y, FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  bool visible = true;
-
-  int bRight = x + width_;    ///< right-most pixel of the object
-  int bBottom = y + height_;  ///< top-most pixel of the object
-
-  int vpX = vp->GetX();                ///< viewport left-most X position
-  int vpY = vp->GetY();                ///< viewport left-most Y position
-  int vpXMax = vpX + vp->GetWidth();   ///< viewport bottom-most X position
-  int vpYMax = vpY + vp->GetHeight();  ///< viewport bottom-most Y position
-
-  if (x >= vpXMax || bRight <= vpX) visible = false;
-  if (y >= vpYMax || bBottom <= vpY) visible = false;
-
-  return visible;
-}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * @file TileCache.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief Cache of the static world layer rasterized into tiles
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights
+ *reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include "TileCache.hpp"
+
+#define kTileBytes \
+  (kTileSize * kTileSize * sizeof(uint16_t))  ///< SRAM of a tile's pixels
+
+/**
+ * @brief Column or row of the tile holding the given x or y, also for
+ *     negative positions
+ */
+static int TileIndex(int position) {
+  return (position >= 0) ? position / kTileSize
+                         : -((kTileSize - 1 - position) / kTileSize);
+}
+
+TileCache::TileCache() : usage_(0), clock_(0) {
+  for (int i = 0; i < kTileCacheEntries; i++) {
+    entries_[i].used = false;
+    entries_[i].pixels = nullptr;
+    entries_[i].sprite = nullptr;
+  }
+}
+
+TileCache &TileCache::GetInstance() {
+  static TileCache instance;
+  return instance;
+}
+
+void TileCache::Release(Entry_t &entry) {
+  if (entry.pixels != nullptr) {
+    usage_ -= kTileBytes;
+    delete entry.sprite;
+    delete[] entry.pixels;
+  }
+  entry.used = false;
+  entry.pixels = nullptr;
+  entry.sprite = nullptr;
+}
+
+TileCache::Entry_t &TileCache::Evict(uint32_t bytes) {
+  while (true) {
+    Entry_t *free = nullptr;
+    Entry_t *oldest = nullptr;
+
+    for (int i = 0; i < kTileCacheEntries; i++) {
+      Entry_t &entry = entries_[i];
+      if (!entry.used) {
+        if (free == nullptr) free = &entry;
+      } else if (oldest == nullptr || entry.last_used < oldest->last_used)
+        oldest = &entry;
+    }
+
+    if (free != nullptr && usage_ + bytes <= kTileCacheBudget) return *free;
+
+    /* bytes <= budget, so there is always something left to evict */
+    Release(*oldest);
+  }
+}
+
+const TileCache::Entry_t &TileCache::Get(int column, int row,
+                                         TileRender_t render) {
+  clock_++;
+  for (int i = 0; i < kTileCacheEntries; i++) {
+    Entry_t &entry = entries_[i];
+    if (entry.used && entry.column == column && entry.row == row) {
+      entry.last_used = clock_;
+      return entry;
+    }
+  }
+
+  /* the tile is drawn like the screen, with its area as viewport */
+  FrameBuffer canvas(kTileSize, kTileSize, canvas_);
+  Viewport vp(kTileSize, kTileSize);
+  vp.UpdateCenter(column * kTileSize + (kTileSize >> 1),
+                  row * kTileSize + (kTileSize >> 1));
+  canvas.clear(kSnakeBackgroundColor);
+  render(&canvas, vp);
+
+  bool empty = true;
+  for (int i = 0; i < kTileSize * kTileSize && empty; i++)
+    empty = (canvas_[i] == kSnakeBackgroundColor);
+
+  Entry_t &entry = Evict(empty ? 0 : kTileBytes);
+  if (!empty) {
+    /* same column-major order as the canvas; the tile is opaque. The panel
+     * runs at 18 bit (666), so RGB565 quantizes the static layer on purpose,
+     * traded for half the memory of ARGB8888 */
+    entry.pixels = new uint16_t[kTileSize * kTileSize];
+    for (int i = 0; i < kTileSize * kTileSize; i++) {
+      uint32_t color = static_cast<uint32_t>(canvas_[i]);
+      entry.pixels[i] = ((color >> 8) & 0xf800) | ((color >> 5) & 0x07e0) |
+                        ((color >> 3) & 0x001f);
+    }
+    entry.sprite = new Sprite(kTileSize, kTileSize, PixelFormat::RGB565,
+                              entry.pixels);
+    usage_ += kTileBytes;
+  }
+  entry.column = static_cast<int16_t>(column);
+  entry.row = static_cast<int16_t>(row);
+  entry.used = true;
+  entry.last_used = clock_;
+  return entry;
+}
+
+void TileCache::Draw(FrameView *fb, TileRender_t render) {
+  Viewport *vp = fb->get_viewport();
+  int column_max = TileIndex(vp->GetX() + vp->GetWidth() - 1);
+  int row_max = TileIndex(vp->GetY() + vp->GetHeight() - 1);
+
+  for (int row = TileIndex(vp->GetY()); row <= row_max; row++) {
+    for (int column = TileIndex(vp->GetX()); column <= column_max; column++) {
+      const Entry_t &tile = Get(column, row, render);
+      if (tile.sprite == nullptr) continue; /* background only */
+
+      int x0 = vp->TranslateX(column * kTileSize);
+      int y0 = vp->TranslateY(row * kTileSize);
+      int cutoffX = (x0 < 0) ? -x0 : 0;
+      int cutoffY = (y0 < 0) ? -y0 : 0;
+
+      fb->blit(x0, y0, cutoffX, cutoffY, kTileSize - cutoffX,
+               kTileSize - cutoffY, tile.sprite);
+    }
+  }
+}
+
+void TileCache::Clear(void) {
+  for (int i = 0; i < kTileCacheEntries; i++) Release(entries_[i]);
+}
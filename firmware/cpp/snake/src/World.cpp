@@ -38,333 +38,185 @@
 
 #include <pico/stdlib.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <vector>
 
 #include "BlackHole.hpp"
 #include "Booster.hpp"
 #include "Bumper.hpp"
 #include "Coin.hpp"
-#include "Coordinates.hpp"
+#include "Entities.hpp"
 #include "Game.hpp"
 #include "Headline.hpp"
+#include "Level.hpp"
 #include "Snake.hpp"
 #include "Text.hpp"
+#include "TileCache.hpp"
+
+#define kWorldLevel "World"  ///< Name of the level in the asset pack
+#define kWallStep (18)       ///< Distance of the bumpers along a wall [px]
 
 /**
- * @brief Vector to store which actions are for wich pickup object
+ * @brief Objects drawn with a sprite of the DIL
  */
-constexpr Action kActions[static_cast<int>(WorldObjects::kPickups)] = {
-    Action::kPickupManufacture1, Action::kPickupManufacture2, Action::kSensor,
-    Action::kPickupFlash,        Action::kPickupSourceCode,   Action::kCredits,
+struct SpriteObjects_t {
+  LevelObject kind;  ///< Kind of the objects
+  DILIndex sprite;   ///< Sprite of all the objects
 };
 
-static void drawWorldLimits(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  int x;
-  int y;
-
-  Bumper &bumper = Bumper::GetInstance();
-
-  x = static_cast<int>(std::floor(vp->GetX() / Bumpers[0].width));
-  y = static_cast<int>(std::floor(vp->GetY() / Bumpers[0].height));
-  y *= Bumpers[0].height;
-
-  /***************************************************************************
-   * Here is the drawing to depict what side of the limits the algorithm
-   * is going to draw.
-   *
-   * --------------------------------------------------> (x)
-   * |  xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │           ┌───────────────────┘
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  └───────────┘
-   * |
-   * \/
-   * (y)
-   **************************************************************************/
-  bumper.SetType(MAX_X - MIN_X, Bumpers[0].height, DILIndex::kBumper);
-  if (bumper.IsVisible(MIN_X, MIN_Y, fb)) {
-    x *= Bumpers[0].width;
-    y = MIN_Y;
-
-    for (int i = 0; x < (int)(vp->GetX() + fb->get_width()) && x < MAX_X; i++) {
-      if (x > MIN_X) bumper.Draw(vp->TranslateX(x), vp->TranslateY(y), fb);
-      x += Bumpers[0].width;
-    }
-  }
+/**
+ * @brief Objects looked up by WorldPrefetch()
+ */
+static const SpriteObjects_t kSpriteObjects[] = {
+    {LevelObject::kNubixLogos, DILIndex::kBackgroundNubix},
+    {LevelObject::k6EArcades, DILIndex::kHeadingTitle},
+    {LevelObject::kCButtons, DILIndex::kButtonC},
+    {LevelObject::kDButtons, DILIndex::kButtonD},
+    {LevelObject::kPickups, DILIndex::kPickup},
+};
 
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  y *= Bumpers[0].height;
-
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-   * |  ┌───────────────────────────────┐
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │           ┌───────────────────┘
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  xxxxxxxxxxxxx
-   * |
-   * \/
-   * (y)
-   **************************************************************************/
-  bumper.SetType(MAX_X - 1393, Bumpers[0].height, DILIndex::kBumper);
-  if (bumper.IsVisible(MIN_X, MAX_Y, fb)) {
-    x *= Bumpers[0].width;
-    y = MAX_Y;
-
-    for (int i = 0; x < (int)(vp->GetX() + fb->get_width()) && x < 1393; i++) {
-      if (x > MIN_X) bumper.Draw(vp->TranslateX(x), vp->TranslateY(y), fb);
-      x += Bumpers[0].width;
-    }
-  }
+static Level level_;  ///< Level of the world, loaded by WorldInit()
+static Entities entities_;  ///< Objects of level_, loaded by WorldInit()
 
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  y *= Bumpers[0].height;
-
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-   * |  ┌───────────────────────────────┐
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │           xxxxxxxxxxxxxxxxxxxxx
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  └───────────┘
-   * |
-   * \/
-   * (y)
-   **************************************************************************/
-  bumper.SetType(MAX_X - 1382, Bumpers[0].height, DILIndex::kBumper);
-  if (bumper.IsVisible(1382, 8663, fb)) {
-    x *= Bumpers[0].width;
-    y = 8663;
-
-    for (int i = 0; x < (int)(vp->GetX() + fb->get_width()) && x < MAX_X; i++) {
-      if (x > 1382) bumper.Draw(vp->TranslateX(x), vp->TranslateY(y), fb);
-      x += Bumpers[0].width;
-    }
-  }
+/**
+ * @brief State of the objects changing while playing, the geometry stays in
+ *     the level in flash. Cleared by WorldInit(); WorldDraw() works on a copy
+ *     of state_ and keeps texts_visible_ to itself, so the cores share
+ *     nothing.
+ */
+static WorldState_t state_;  ///< Written by WorldUpdate()
+static std::vector<bool>
+    pickups_picked_;  ///< Pickups collided with, until their decay elapses
+static std::vector<int32_t>
+    pickup_decays_;  ///< Frames until a pickup can be picked again
+static std::vector<bool>
+    texts_visible_;  ///< Fading texts being shown, written by WorldDraw()
 
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  x *= Bumpers[0].width;
-
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-   * |  x───────────────────────────────┐
-   * |  x                               │
-   * |  x                               │
-   * |  x                               │
-   * |  x                               │
-   * |  x                               │
-   * |  x           ┌───────────────────┘
-   * |  x           │
-   * |  x           │
-   * |  x           │
-   * |  x           │
-   * |  x           │
-   * |  x───────────┘
-   * |
-   * \/
-   * (y)
-   **************************************************************************/
-  bumper.SetType(Bumpers[0].width, MAX_Y - MIN_Y, DILIndex::kBumper);
-  if (bumper.IsVisible(MIN_X, MIN_Y, fb)) {
-    x = MIN_X;
-    y *= Bumpers[0].height;
-
-    for (int i = 0; y < (int)(vp->GetY() + fb->get_height()) && y < MAX_Y;
-         i++) {
-      if (y > MIN_Y) bumper.Draw(vp->TranslateX(x), vp->TranslateY(y), fb);
-      y += Bumpers[0].width;
-    }
-  }
+/**
+ * @brief Vector to store which actions are for wich pickup object, further
+ *     pickups of a level keep the game running
+ */
+constexpr Action kActions[] = {
+    Action::kPickupManufacture1, Action::kPickupManufacture2, Action::kSensor,
+    Action::kPickupFlash,        Action::kPickupSourceCode,   Action::kCredits,
+};
 
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  x *= Bumpers[0].width;
-
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-   * |  ┌───────────────────────────────┐
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │                               │
-   * |  │          x────────────────────┘
-   * |  │          x
-   * |  │          x
-   * |  │          x
-   * |  │          x
-   * |  │          x
-   * |  └──────────x
-   * |
-   * \/
-   * (y)
-   **************************************************************************/
-  if (bumper.IsVisible(1382, 8680, fb)) {
-    x = 1382;
-    y *= Bumpers[0].height;
-
-    for (int i = 0; y < (int)(vp->GetY() + fb->get_height()) && y < MAX_Y;
-         i++) {
-      if (y > 8663) bumper.Draw(vp->TranslateX(x), vp->TranslateY(y), fb);
-      y += Bumpers[0].width;
-    }
-  }
+/**
+ * @brief Visits the bumpers of the walls which may intersect the given area.
+ *     The bumpers sit on the multiples of kWallStep strictly between the ends
+ *     of each segment and extend kWallStep to the right and below.
+ *
+ * @param x_min Left of the area
+ * @param y_min Top of the area
+ * @param x_max Right of the area, exclusive
+ * @param y_max Bottom of the area, exclusive
+ * @param visit Called with the x and y of each bumper
+ */
+template <typename Visit>
+static void forEachWallBumper(int x_min, int y_min, int x_max, int y_max,
+                              Visit visit) {
+  for (int w = 0; w < level_.GetWallCount(); w++) {
+    int count;
+    const LevelPoint_t *points = level_.GetWall(w, count);
+
+    for (int p = 1; p < count; p++) {
+      const LevelPoint_t &a = points[p - 1];
+      const LevelPoint_t &b = points[p];
+      bool horizontal = (a.y == b.y);
+
+      /* the coordinate shared by the segment's bumpers */
+      int fixed = horizontal ? a.y : a.x;
+      if (fixed <= (horizontal ? y_min : x_min) - kWallStep ||
+          fixed >= (horizontal ? y_max : x_max))
+        continue;
 
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-   * |  ┌───────────────────────────────x
-   * |  │                               x
-   * |  │                               x
-   * |  │                               x
-   * |  │                               x
-   * |  │                               x
-   * |  │           ┌───────────────────x
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  │           │
-   * |  └───────────┘
-   * |
-   * \/
-   * (y)
-   **************************************************************************/
-  if (bumper.IsVisible(MAX_X, MIN_Y, fb)) {
-    x = MAX_X;
-    y *= Bumpers[0].height;
-
-    for (int i = 0; y < (int)(vp->GetY() + fb->get_height()) && y < 8663; i++) {
-      if (y > MIN_Y) bumper.Draw(vp->TranslateX(x), vp->TranslateY(y), fb);
-      y += Bumpers[0].width;
+      int from = horizontal ? std::min(a.x, b.x) : std::min(a.y, b.y);
+      int to = horizontal ? std::max(a.x, b.x) : std::max(a.y, b.y);
+      from = std::max(from, (horizontal ? x_min : y_min) - kWallStep);
+      to = std::min(to, horizontal ? x_max : y_max);
+
+      /* first multiple of kWallStep above from, also for negative ones */
+      int step = from - ((from % kWallStep) + kWallStep) % kWallStep;
+      for (step += kWallStep; step < to; step += kWallStep) {
+        if (horizontal)
+          visit(step, fixed);
+        else
+          visit(fixed, step);
+      }
     }
   }
 }
 
-static void drawNubixLogo(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  Object &object = Object::GetInstance();
+static void drawWorldLimits(FrameBuffer *fb, const Viewport &vp) {
+  BakeCache &cache = BakeCache::GetInstance();
 
-  object.SetType(NubixLogos[0].width, NubixLogos[0].height,
-                 DILIndex::kBackgroundNubix);
-  if (object.IsVisible(NubixLogos[0].x, NubixLogos[0].y, fb))
-    object.Draw(vp->TranslateX(NubixLogos[0].x),
-                vp->TranslateY(NubixLogos[0].y), fb);
+  /* the walls of the level surround the world with bumpers */
+  forEachWallBumper(vp.GetX(), vp.GetY(), vp.GetX() + vp.GetWidth(),
+                    vp.GetY() + vp.GetHeight(), [&](int x, int y) {
+                      cache.Draw(Bumper::GetShape(), vp.TranslateX(x),
+                                 vp.TranslateY(y), fb);
+                    });
 }
 
-static void drawSixEuroLogo(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  Object &object = Object::GetInstance();
-
-  object.SetType(_6EArcades[0].width, _6EArcades[0].height,
-                 DILIndex::kHeadingTitle);
-  if (object.IsVisible(_6EArcades[0].x, _6EArcades[0].y, fb))
-    object.Draw(vp->TranslateX(_6EArcades[0].x),
-                vp->TranslateY(_6EArcades[0].y), fb);
+static void drawNubixLogo(FrameBuffer *fb, const Viewport &vp) {
+  entities_.DrawSprites(LevelObject::kNubixLogos, DILIndex::kBackgroundNubix,
+                        fb, vp);
 }
 
-static void drawDecorativeHexagons(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  Object &object = Object::GetInstance();
-
-  object.SetType(Decorative_Hexagons[0].width, Decorative_Hexagons[0].height,
-                 DILIndex::kHexagon);
+static void drawSixEuroLogo(FrameBuffer *fb, const Viewport &vp) {
+  entities_.DrawSprites(LevelObject::k6EArcades, DILIndex::kHeadingTitle, fb,
+                        vp);
+}
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kDecorative_Hexagons);
-       i++) {
-    if (object.IsVisible(Decorative_Hexagons[i].x, Decorative_Hexagons[i].y,
-                         fb))
-      object.Draw(vp->TranslateX(Decorative_Hexagons[i].x),
-                  vp->TranslateY(Decorative_Hexagons[i].y), fb);
-  }
+static void drawDecorativeHexagons(FrameBuffer *fb, const Viewport &vp) {
+  entities_.DrawSprites(LevelObject::kDecorativeHexagons, DILIndex::kHexagon,
+                        fb, vp);
 }
 
-static void drawBlackHole(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  BlackHole &blackhole = BlackHole::GetInstance();
-  // blackhole.SetType(BlackHoles[0].width, BlackHoles[0].height,
-  // DILIndex::kBlackHole);
-  blackhole.SetType(200, 200, DILIndex::kBlackHole);  // TODO::FIX THIS
-
-  for (int i = 0; i < static_cast<int>(WorldObjects::kBlackHoles); i++) {
-    /* x and y refers to the center of the object */
-    if (blackhole.IsVisible(BlackHoles[i].x - BlackHoles[i].width,
-                            BlackHoles[i].y - BlackHoles[i].height, fb)) {
-      blackhole.Draw(vp->TranslateX(BlackHoles[i].x),
-                     vp->TranslateY(BlackHoles[i].y), fb);
-      BlackHoles[i].visible = true;
-    } else
-      BlackHoles[i].visible = false;
-  }
+static void drawBlackHole(FrameBuffer *fb, const Viewport &vp) {
+  /* x and y refers to the center of the black holes */
+  entities_.DrawShapes(LevelObject::kBlackHoles, BlackHole::GetShape(), fb,
+                       vp);
 }
 
-static void drawHeadline(FrameView *fb) {
+static void drawHeadline(FrameBuffer *fb, const Viewport &vp) {
   char index[2] = "0";
-  Viewport *vp = fb->get_viewport();
   Headline &headline = Headline::GetInstance();
-
-  for (int i = 0; i < static_cast<int>(WorldObjects::kHeadlines); i++) {
-    unsigned int width =
-        strlen(Headlines[i].text) * headline.GetFont().getWidth();
-    unsigned int height = HEADLINE_LINES * headline.GetFont().getHeight();
-    headline.SetType(width, height, DILIndex::kHeadline);
-    if (headline.IsVisible(Headlines[i].x, Headlines[i].y, fb)) {
+  const LevelObjects_t &headlines = entities_.Get(LevelObject::kHeadlines);
+
+  /* the extent of a headline is the one of its text */
+  for (int i = 0; i < headlines.count; i++) {
+    const char *title = level_.GetText(LevelObject::kHeadlines, i);
+    int width = strlen(title) * headline.GetFont().getWidth();
+    int height = HEADLINE_LINES * headline.GetFont().getHeight();
+    if (Entities::IsVisible(vp, headlines.x[i], headlines.y[i], width,
+                            height)) {
       index[0] = '1' + i;
-      headline.SetHeadline(index, Headlines[i].text);
-      headline.Draw(vp->TranslateX(Headlines[i].x),
-                    vp->TranslateY(Headlines[i].y), fb);
+      headline.SetHeadline(index, title);
+      headline.Draw(vp.TranslateX(headlines.x[i]),
+                    vp.TranslateY(headlines.y[i]), fb);
     }
   }
 }
 
-static void drawFadingText(FrameView *fb) {
+static void drawFadingText(FrameView *fb, const WorldState_t &state) {
   Viewport *vp = fb->get_viewport();
   Text &text = Text::GetInstance();
   char *ptr = NULL;
 
-  text.SetType(10, 10, DILIndex::kFadingText);  // TODO change sizes here
   text.SetSize(TextSize::Small);
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kFadingTextAreas); i++) {
-    static Coordinate_t coordinate = {.x = 0,
-                                      .y = 0,
-                                      .visible = 0,
-                                      .picked = 0,
-                                      .width = 0,
-                                      .height = 0,
-                                      .decay = 0x00};
+  const LevelObjects_t &areas =
+      entities_.Get(LevelObject::kFadingTextAreas);
+
+  for (int i = 0; i < areas.count; i++) {
+    const char *message = level_.GetText(LevelObject::kFadingTextAreas, i);
+    static uint32_t alpha = 0;
     static uint32_t decay = 0;
 
-    if (FadingTextAreas[i].picked == true || FadingTextAreas[i].visible) {
+    if (WorldState_t::Get(state.texts_picked, i) || texts_visible_[i]) {
       decay++;
 
 #define FADING_TOGGLE UINT32_C(15)
@@ -372,462 +224,243 @@ static void drawFadingText(FrameView *fb) {
 #define FADING_STABLE UINT32_C(10)
 
       if (decay < FADING_TOGGLE) {
-        FadingTextAreas[i].visible = true;
-        coordinate.decay += 8;
+        texts_visible_[i] = true;
+        alpha += 8;
       } else if (decay < (FADING_TOGGLE + FADING_IN_OUT))
-        coordinate.decay = 0xff;
+        alpha = 0xff;
       else if (decay < (FADING_TOGGLE + FADING_IN_OUT + FADING_STABLE))
-        coordinate.decay -= 8;
+        alpha -= 8;
       else if (decay < (FADING_TOGGLE + 2 * FADING_IN_OUT + FADING_STABLE)) {
         decay = 0;
-        coordinate.decay = 0;
-        FadingTextAreas[i].visible = false;
+        alpha = 0;
+        texts_visible_[i] = false;
       }
-      Color color = static_cast<Color>((coordinate.decay << 24) | 0x00FFDEAD);
-      ptr = strstr(FadingTextAreas[i].text, "\n");
+      Color color = static_cast<Color>((alpha << 24) | 0x00FFDEAD);
+      ptr = strstr(message, "\n");
       if (ptr) {
         int len = 0;
-        const char *begin = FadingTextAreas[i].text;
+        const char *begin = message;
         while (begin++ != ptr) len++;
-        text.SetText(FadingTextAreas[i].text, len, ++ptr, strlen(ptr));
-        text.Draw(fb, color, vp->TranslateX(FadingTextAreas[i].x),
-                  vp->TranslateY(FadingTextAreas[i].y));
+        text.SetText(message, len, ++ptr, strlen(ptr));
+        text.Draw(fb, color, vp->TranslateX(areas.x[i]),
+                  vp->TranslateY(areas.y[i]));
       } else {
-        text.SetText(FadingTextAreas[i].text);
-        text.Draw(fb, color, vp->TranslateX(FadingTextAreas[i].x),
-                  vp->TranslateY(FadingTextAreas[i].y));
+        text.SetText(message);
+        text.Draw(fb, color, vp->TranslateX(areas.x[i]),
+                  vp->TranslateY(areas.y[i]));
       }
     }
   }
 }
 
-static void drawPickups(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  Object &pickup = Object::GetInstance();
-
-  for (int i = 0; i < static_cast<int>(WorldObjects::kPickups); i++) {
-    pickup.SetType(64, 64, DILIndex::kPickup);
-    if (pickup.IsVisible(Pickups[i].x, Pickups[i].y, fb)) {
-      pickup.Draw(vp->TranslateX(Pickups[i].x), vp->TranslateY(Pickups[i].y),
-                  fb);
-      Pickups[i].visible = true;
-    } else
-      Pickups[i].visible = false;
-  }
+static void drawPickups(FrameBuffer *fb, const Viewport &vp) {
+  entities_.DrawSprites(LevelObject::kPickups, DILIndex::kPickup, fb, vp);
 }
 
-static void drawBumper(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  Bumper &bumper = Bumper::GetInstance();
-
-  for (int i = 0; i < static_cast<int>(WorldObjects::kBumpers); i++) {
-    if (bumper.IsVisible(Bumpers[i].x, Bumpers[i].y, fb)) {
-      bumper.Draw(vp->TranslateX(Bumpers[i].x), vp->TranslateY(Bumpers[i].y),
-                  fb);
-      Bumpers[i].visible = true;
-    } else
-      Bumpers[i].visible = false;
-  }
+static void drawBumper(FrameBuffer *fb, const Viewport &vp) {
+  entities_.DrawShapes(LevelObject::kBumpers, Bumper::GetShape(), fb, vp);
 }
 
-static void drawButtons(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  Object &buttons = Object::GetInstance();
-
-  buttons.SetType(CButtons[0].width, CButtons[0].height, DILIndex::kButtonC);
-
-  if (buttons.IsVisible(CButtons[0].x, CButtons[0].y, fb))
-    buttons.Draw(vp->TranslateX(CButtons[0].x), vp->TranslateY(CButtons[0].y),
-                 fb);
-
-  buttons.SetType(DButtons[0].width, DButtons[0].height, DILIndex::kButtonD);
-  if (buttons.IsVisible(DButtons[0].x, DButtons[0].y, fb))
-    buttons.Draw(vp->TranslateX(DButtons[0].x), vp->TranslateY(DButtons[0].y),
-                 fb);
+static void drawButtons(FrameBuffer *fb, const Viewport &vp) {
+  entities_.DrawSprites(LevelObject::kCButtons, DILIndex::kButtonC, fb, vp);
+  entities_.DrawSprites(LevelObject::kDButtons, DILIndex::kButtonD, fb, vp);
 }
 
-static void drawBooster(FrameView *fb) {
-  Viewport *vp = fb->get_viewport();
-  Booster &booster = Booster::GetInstance();
+static void drawBooster(FrameBuffer *fb, const Viewport &vp) {
+  entities_.DrawShapes(LevelObject::kBoosters, Booster::GetShape(), fb, vp);
+}
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kBoosters); i++) {
-    if (booster.IsVisible(Boosters[i].x, Boosters[i].y, fb)) {
-      booster.Draw(vp->TranslateX(Boosters[i].x), vp->TranslateY(Boosters[i].y),
-                   fb);
-      Boosters[i].visible = true;
-    } else
-      Boosters[i].visible = false;
-  }
+/**
+ * @brief Draws everything of the world which never changes, rasterized into
+ *     the tiles of the TileCache
+ */
+static void drawStatic(FrameBuffer *fb, const Viewport &vp) {
+  drawNubixLogo(fb, vp);
+  drawSixEuroLogo(fb, vp);
+  drawBlackHole(fb, vp);
+  drawHeadline(fb, vp);
+  drawBumper(fb, vp);
+  drawButtons(fb, vp);
+  drawBooster(fb, vp);
+  drawPickups(fb, vp);
+  drawWorldLimits(fb, vp);
 }
 
-static void drawCoins(FrameView *fb) {
+static void drawCoins(FrameView *fb, const WorldState_t &state) {
   Viewport *vp = fb->get_viewport();
-  Coin &coin = Coin::GetInstance();
-
-  coin.SetType(Collectables[0].width, Collectables[0].height, DILIndex::kCoin);
-
-  for (int i = 0; i < static_cast<int>(WorldObjects::kCollectables); i++) {
-    coin.SetCollected(Collectables[i].picked);
-
-    if (coin.IsVisible(Collectables[i].x, Collectables[i].y, fb)) {
-      coin.Draw(vp->TranslateX(Collectables[i].x),
-                vp->TranslateY(Collectables[i].y), fb);
-      Collectables[i].visible = true;
-    } else
-      Collectables[i].visible = true;
-  }
+  BakeCache &cache = BakeCache::GetInstance();
+  const LevelObjects_t &coins = entities_.Get(LevelObject::kCollectables);
+
+  if (coins.count == 0) return;
+
+  /* all the coins have the size of the first one, collected or not */
+  const BakeShape_t shapes[] = {Coin::GetShape(coins.width[0], false),
+                                Coin::GetShape(coins.width[0], true)};
+  EntityBox_t box = {-shapes[0].origin_x, -shapes[0].origin_y,
+                     shapes[0].width, shapes[0].height};
+
+  entities_.ForEachInArea(
+      LevelObject::kCollectables, box, vp->GetX(), vp->GetY(),
+      vp->GetWidth(), vp->GetHeight(), [&](int i) {
+        cache.Draw(shapes[WorldState_t::Get(state.coins_picked, i)],
+                   vp->TranslateX(coins.x[i]), vp->TranslateY(coins.y[i]),
+                   fb);
+      });
 }
 
 static void updateBlackHole(FrameView *fb, Particle &particle) {
   (void)fb;
 
-  BlackHole &blackhole = BlackHole::GetInstance();
+  const LevelObjects_t &black_holes = entities_.Get(LevelObject::kBlackHoles);
+  Vector &position = particle.GetPosition();
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kBlackHoles); i++) {
-    if (BlackHoles[i].visible)
-      blackhole.GravityPull(BlackHoles[i].x, BlackHoles[i].y, particle);
-  }
+  /* the pull reaches half of the width, at most UINT8_MAX, around the
+   * center */
+  entities_.ForEachNear(
+      LevelObject::kBlackHoles, position.GetX(), position.GetY(),
+      UINT8_MAX / 2 + 1, [&](int i) {
+        BlackHole::GravityPull(black_holes.x[i], black_holes.y[i], particle);
+      });
 }
 
 static void updateFadingText(FrameView *fb, Particle &particle) {
   (void)fb;
-  Text &text = Text::GetInstance();
-  text.SetType(10, 10, DILIndex::kButtonC);  // TODO change sizes here
-  text.SetSize(TextSize::Small);
+  const LevelObjects_t &areas =
+      entities_.Get(LevelObject::kFadingTextAreas);
+  int x = particle.GetPosition().GetX();
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kFadingTextAreas); i++) {
-    if (particle.GetPosition().GetX() >= FadingTextAreas[i].x &&
-        particle.GetPosition().GetX() < FadingTextAreas[i].x + 10)
-      FadingTextAreas[i].picked = true;
-    else
-      FadingTextAreas[i].picked = false;
-  }
+  for (int i = 0; i < areas.count; i++)
+    WorldState_t::Set(state_.texts_picked, i,
+                      (x >= areas.x[i]) & (x < areas.x[i] + 10));
 }
 
 static Action updatePickup(FrameView *fb, Particle &particle) {
   (void)fb;
   Action index = Action::kKeepRunning;
-  Object &pickup = Object::GetInstance();
-
-  for (int i = 0; i < static_cast<int>(WorldObjects::kPickups); i++) {
-    pickup.SetType(Pickups[i].width / 2, Pickups[i].height / 2,
-                   DILIndex::kPickup);
+  const LevelObjects_t &pickups = entities_.Get(LevelObject::kPickups);
+  int actions = static_cast<int>(sizeof(kActions) / sizeof(kActions[0]));
 
+  for (int i = 0; i < pickups.count; i++) {
     /* if we collide with a pickup object, that will cause a state change
      * to show the fullscreen image. So, it is safe here to store the
      * Action for a single collision, because we will never collide with
      * more than one pickup object at the time.
      */
-    if (!Pickups[i].visible) continue;
-
-    if (Pickups[i].picked) {
-      if (--Pickups[i].decay <= 0)
-        Pickups[i].picked = false;
+    if (pickups_picked_[i]) {
+      if (--pickup_decays_[i] <= 0)
+        pickups_picked_[i] = false;
       else
         continue;
     }
 
-    if (pickup.CheckCollision(Pickups[i].x + Pickups[i].width / 2,
-                              Pickups[i].y + Pickups[i].height / 2, particle)) {
-      if (!Pickups[i].picked) {
-        Pickups[i].picked = true;
-        Pickups[i].decay = INT32_C(2) * GAME_FPS;
+    /* hit within a quarter of the width around the center */
+    if (particle.IsCloserThan(pickups.x[i] + pickups.width[i] / 2,
+                              pickups.y[i] + pickups.height[i] / 2,
+                              pickups.width[i] / 4)) {
+      if (!pickups_picked_[i]) {
+        pickups_picked_[i] = true;
+        pickup_decays_[i] = INT32_C(2) * GAME_FPS;
       }
-      index = kActions[i];
+      if (i < actions) index = kActions[i];
     }
   }
   return index;
 }
 
 static void updateWorldLimitsBumper(FrameView *fb, Particle &particle) {
-  Viewport *vp = fb->get_viewport();
-  int x;
-  int y;
-
-  Bumper &bumper = Bumper::GetInstance();
-
-  x = static_cast<int>(std::floor(vp->GetX() / Bumpers[0].width));
-  y = static_cast<int>(std::floor(vp->GetY() / Bumpers[0].height));
-  y *= Bumpers[0].height;
-
-  /***************************************************************************
-   * Here is the drawing to depict what side of the limits the algorithm
-   * is going to draw.
-   *
-   * --------------------------------------------------> (x)
-     |  xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │           ┌───────────────────┘
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  └───────────┘
-     |
-     \/
-     (y)
-  ***************************************************************************/
-  bumper.SetType(MAX_X - MIN_X, Bumpers[0].height, DILIndex::kBumper);
-  if (bumper.IsVisible(MIN_X, MIN_Y, fb)) {
-    x *= Bumpers[0].width;
-    y = MIN_Y;
-
-    bumper.SetType(Bumpers[0].width, Bumpers[0].height, DILIndex::kBumper);
-
-    for (int i = 0; x < (int)(vp->GetX() + fb->get_width()) && x < MAX_X; i++) {
-      bumper.CheckCollision(x, y, particle);
-      x += Bumpers[0].width;
-    }
-  }
-
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  y *= Bumpers[0].height;
-
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-     |  ┌───────────────────────────────┐
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │           ┌───────────────────┘
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  xxxxxxxxxxxxx
-     |
-     \/
-     (y)
-  ***************************************************************************/
-  bumper.SetType(MAX_X - 1393, Bumpers[0].height, DILIndex::kBumper);
-  if (bumper.IsVisible(MIN_X, MAX_Y, fb)) {
-    x *= Bumpers[0].width;
-    y = MAX_Y;
-
-    for (int i = 0; x < (int)(vp->GetX() + fb->get_width()) && x < 1393; i++) {
-      bumper.CheckCollision(x, y, particle);
-      x += Bumpers[0].width;
-    }
-  }
-
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  y *= Bumpers[0].height;
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-     |  ┌───────────────────────────────┐
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │           xxxxxxxxxxxxxxxxxxxxx
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  └───────────┘
-     |
-     \/
-     (y)
-  ***************************************************************************/
-  bumper.SetType(MAX_X - 1459, Bumpers[0].height, DILIndex::kBumper);
-  if (bumper.IsVisible(1459, 8663, fb)) {
-    x *= Bumpers[0].width;
-    y = 8663;
-
-    for (int i = 0; x < (int)(vp->GetX() + fb->get_width()) && x < MAX_X; i++) {
-      bumper.CheckCollision(x, y, particle);
-      x += Bumpers[0].width;
-    }
-  }
-
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  x *= Bumpers[0].width;
-
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-     |  x───────────────────────────────┐
-     |  x                               │
-     |  x                               │
-     |  x                               │
-     |  x                               │
-     |  x                               │
-     |  x           ┌───────────────────┘
-     |  x           │
-     |  x           │
-     |  x           │
-     |  x           │
-     |  x           │
-     |  x───────────┘
-     |
-     \/
-     (y)
-  ***************************************************************************/
-  bumper.SetType(Bumpers[0].width, MAX_Y - MIN_Y, DILIndex::kBumper);
-  if (bumper.IsVisible(MIN_X, MIN_Y, fb)) {
-    x = MIN_X;
-    y *= Bumpers[0].height;
-
-    bumper.SetType(Bumpers[0].width, Bumpers[0].height, DILIndex::kBumper);
-
-    for (int i = 0; y < (int)(vp->GetY() + fb->get_height()) && y < MAX_Y;
-         i++) {
-      bumper.CheckCollision(x, y, particle);
-      y += Bumpers[0].width;
-    }
-  }
-
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  x *= Bumpers[0].width;
-
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-     |  ┌───────────────────────────────┐
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │                               │
-     |  │          x────────────────────┘
-     |  │          x
-     |  │          x
-     |  │          x
-     |  │          x
-     |  │          x
-     |  └──────────x
-     |
-     \/
-     (y)
-  ***************************************************************************/
-  if (bumper.IsVisible(1382, 8733 /*8695*/, fb)) {
-    x = 1382;
-    y *= Bumpers[0].height;
-
-    bumper.SetType(Bumpers[0].width, Bumpers[0].height, DILIndex::kBumper);
-
-    for (int i = 0; y < (int)(vp->GetY() + fb->get_height()) && y < 9500; i++) {
-      bumper.CheckCollision(x, y, particle);
-      y += Bumpers[0].width;
-    }
-  }
+  (void)fb;
+  int x = static_cast<int>(particle.GetPosition().GetX());
+  int y = static_cast<int>(particle.GetPosition().GetY());
 
-  x = std::floor(vp->GetX() / Bumpers[0].width);
-  y = std::floor(vp->GetY() / Bumpers[0].height);
-  x *= Bumpers[0].width;
-  /***************************************************************************
-   * --------------------------------------------------> (x)
-     |  ┌───────────────────────────────x
-     |  │                               x
-     |  │                               x
-     |  │                               x
-     |  │                               x
-     |  │                               x
-     |  │           ┌───────────────────x
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  │           │
-     |  └───────────┘
-     |
-     \/
-     (y)
-  ***************************************************************************/
-  bumper.SetType(Bumpers[0].width, MAX_Y - MIN_Y, DILIndex::kBumper);
-  if (bumper.IsVisible(4297, MIN_Y, fb)) {
-    // x = MAX_X;
-    x = 4297;
-    y *= Bumpers[0].height;
-
-    for (int i = 0; y < (int)(vp->GetY() + fb->get_height()) && y < 8733; i++) {
-      bumper.CheckCollision(x, y, particle);
-      y += Bumpers[0].width;
-    }
-  }
+  /* the particle collides inside the box right and below a bumper */
+  forEachWallBumper(x, y, x + 1, y + 1, [&](int bumper_x, int bumper_y) {
+    Bumper::CheckCollision(bumper_x, bumper_y, particle);
+  });
 }
 
 static void updateBumper(FrameView *fb, Particle &particle) {
   (void)fb;
-  Bumper &bumper = Bumper::GetInstance();
+  const LevelObjects_t &bumpers = entities_.Get(LevelObject::kBumpers);
+  Vector &position = particle.GetPosition();
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kBumpers); i++) {
-    if (Bumpers[i].visible)
-      bumper.CheckCollision(Bumpers[i].x, Bumpers[i].y, particle);
-  }
+  if (bumpers.count == 0) return;
+
+  /* the particle collides inside the box right and below x and y */
+  entities_.ForEachNear(
+      LevelObject::kBumpers, position.GetX(), position.GetY(),
+      bumpers.width[0] + 1, [&](int i) {
+        Bumper::CheckCollision(bumpers.x[i], bumpers.y[i], particle);
+      });
 }
 
 static void updateBooster(FrameView *fb, Particle &particle) {
   (void)fb;
-  Booster &booster = Booster::GetInstance();
+  const LevelObjects_t &boosters = entities_.Get(LevelObject::kBoosters);
+  Vector &position = particle.GetPosition();
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kBoosters); i++) {
-    if (Boosters[i].visible)
-      booster.CheckCollision(Boosters[i].x, Boosters[i].y, particle);
-  }
+  if (boosters.count == 0) return;
+
+  /* the particle collides within a width around the center of the booster */
+  entities_.ForEachNear(
+      LevelObject::kBoosters, position.GetX(), position.GetY(),
+      boosters.width[0] * 3 / 2 + 1, [&](int i) {
+        Booster::CheckCollision(boosters.x[i], boosters.y[i], particle);
+      });
 }
 
 static void updateCoin(FrameView *fb, Particle &particle) {
   (void)fb;
-  Coin &coin = Coin::GetInstance();
-
-  for (int i = 0; i < static_cast<int>(WorldObjects::kCollectables); i++) {
-    if (!Collectables[i].visible) continue;
-
-    bool collided =
-        coin.CheckCollision(Collectables[i].x, Collectables[i].y, particle);
-
-    if (!Collectables[i].picked) Collectables[i].picked = collided;
-  }
+  const LevelObjects_t &coins = entities_.Get(LevelObject::kCollectables);
+  Vector &position = particle.GetPosition();
+
+  if (coins.count == 0) return;
+
+  /* the particle collects within two widths around the coin */
+  entities_.ForEachNear(
+      LevelObject::kCollectables, position.GetX(), position.GetY(),
+      2 * coins.width[0] + 1, [&](int i) {
+        if (Coin::CheckCollision(coins.x[i], coins.y[i], coins.width[0],
+                                 particle))
+          WorldState_t::Set(state_.coins_picked, i, true);
+      });
 }
 
 void WorldInit() {
-  /* first set to default values for the number of callers */
-  for (int i = 0; i < static_cast<int>(DILIndex::kNumDIL); i++)
-    DIL::GetInstance().SetNumberOfCallers(static_cast<DILIndex>(i), 1);
-
-  for (int i = static_cast<int>(DILIndex::kBlackHole);
-       i < static_cast<int>(DILIndex::kNumDIL); i++) {
-    DIL::GetInstance().SetNumberOfCallers(
-        static_cast<DILIndex>(i), static_cast<int>(WorldObjects::kBlackHoles));
-  }
+  const AssetPack *pack = DIL::GetInstance().GetAssets();
+  const uint32_t *blob = nullptr;
+  uint32_t size = 0;
 
-  for (int i = 0; i < static_cast<int>(WorldObjects::kCollectables); i++)
-    Collectables[i].visible = true;
+  if (pack != nullptr)
+    blob = pack->find(AssetPack::hash(kWorldLevel), AssetType::Level, size);
+  level_.Load(blob, size);
 
-  DIL::GetInstance().SetNumberOfCallers(
-      DILIndex::kPickup, static_cast<int>(WorldObjects::kPickups));
+  entities_.Load(level_);
+
+  state_ = {};
+  pickups_picked_.assign(level_.GetCount(LevelObject::kPickups), false);
+  pickup_decays_.assign(level_.GetCount(LevelObject::kPickups), 0);
+  texts_visible_.assign(level_.GetCount(LevelObject::kFadingTextAreas), false);
 }
 
 void WorldDeinit() {
-  for (int i = 0; i < static_cast<int>(WorldObjects::kCollectables); i++)
-    Collectables[i].visible = true;
+  memset(state_.coins_picked, 0, sizeof(state_.coins_picked));
+  std::fill(pickups_picked_.begin(), pickups_picked_.end(), false);
+  std::fill(texts_visible_.begin(), texts_visible_.end(), false);
 }
 
-void WorldDraw(FrameView *fb) {
-  drawNubixLogo(fb);
-  drawSixEuroLogo(fb);
-  drawBlackHole(fb);
-  drawHeadline(fb);
-  drawBumper(fb);
-  drawButtons(fb);
-  drawBooster(fb);
-  drawPickups(fb);
-  drawCoins(fb);
-  drawWorldLimits(fb);
-  drawFadingText(fb);
+void WorldSpawn(Snake &snake) {
+  if (!level_.IsLoaded()) return;
+
+  LevelPoint_t spawn = level_.GetSpawn();
+  snake.MoveTo(spawn.x, spawn.y);
+}
+
+void WorldGetState(WorldState_t &state) { state = state_; }
+
+void WorldDraw(FrameView *fb, const WorldState_t &state) {
+  TileCache::GetInstance().Draw(fb, &drawStatic);
+  drawCoins(fb, state);
+  drawFadingText(fb, state);
 }
 
 Action WorldUpdate(FrameView *fb, Particle &particle) {
@@ -843,3 +476,23 @@ Action WorldUpdate(FrameView *fb, Particle &particle) {
 
   return index;
 }
+
+void WorldPrefetch(Viewport *vp, Particle &particle) {
+  Vector &velocity = particle.GetVelocity();
+  int dx = ToInt(velocity.x_ * kWorldPrefetchFrames);
+  int dy = ToInt(velocity.y_ * kWorldPrefetchFrames);
+
+  /* area swept by the viewport until it reaches the predicted position */
+  int x_min = vp->GetX() + (dx < 0 ? dx : 0);
+  int x_max = vp->GetX() + vp->GetWidth() + (dx > 0 ? dx : 0);
+  int y_min = vp->GetY() + (dy < 0 ? dy : 0);
+  int y_max = vp->GetY() + vp->GetHeight() + (dy > 0 ? dy : 0);
+
+  for (const SpriteObjects_t &entry : kSpriteObjects) {
+    bool visible = false;
+
+    entities_.ForEachInArea(entry.kind, x_min, y_min, x_max - x_min,
+                            y_max - y_min, [&](int) { visible = true; });
+    if (visible) DIL::GetInstance().Prefetch(entry.sprite);
+  }
+}
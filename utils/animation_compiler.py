@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+'''!
+@file
+@company nubix Software-Design GmbH
+@date 2026-10-18
+@brief Convert a sequence of images into an animation blob for AnimatedSprite::load()
+@details Frame 0 is stored as raw pixels, every later frame only as the runs of
+         pixels which differ from the frame before, plus the runs back to
+         frame 0 for looping. Pixels are ordered column by column like
+         sprite_compiler.py writes them.
+'''
+
+import sys, os, getopt, struct
+from PIL import Image, ImageSequence
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from sprite_compiler import FORMATS, convert
+
+MAGIC = 0x494e414e # "NANI" read little endian
+
+# unchanged pixels up to this many bytes are copied along rather than starting a new run
+RUN_HEADER = 8
+
+def pad(data : bytes) -> bytes:
+    return data + bytes(-len(data) % 4)
+
+def pixels(image : Image.Image, pixel_format : str) -> list:
+    '''
+    Column-major pixels of the format, like Sprite and the FrameBuffer default layout
+    '''
+    width, height = image.size
+    data = image.convert("RGBA").load()
+    return [convert(data[x, y], pixel_format) for x in range(width) for y in range(height)]
+
+def delta(before : list, after : list) -> bytes:
+    '''
+    Runs of changed pixels; a uint32 number of runs, then offset, count and pixels per run
+    '''
+    changed = [i for i in range(len(after)) if after[i] != before[i]]
+    runs = []
+    for i in changed:
+        if runs and (i - runs[-1][1]) * len(after[i]) <= RUN_HEADER:
+            runs[-1][1] = i + 1
+        else:
+            runs.append([i, i + 1])
+    out = struct.pack("<I", len(runs))
+    for start, end in runs:
+        out += struct.pack("<II", start, end - start) + pad(b''.join(after[start:end]))
+    return out
+
+def compile_animation(frames : list, durations : list, pixel_format : str) -> bytes:
+    '''
+    Whole blob of an animation: header, durations, keyframe and deltas
+    '''
+    width, height = frames[0].size
+    if width > 0xFFFF or height > 0xFFFF or len(frames) > 0xFFFF:
+        raise Exception("animation too large")
+    if any(frame.size != frames[0].size for frame in frames):
+        raise Exception("all frames need the same size")
+    if any(duration < 1 or duration > 0xFFFF for duration in durations):
+        raise Exception("frame durations need to be 1 to 65535 ms")
+
+    converted = [pixels(frame, pixel_format) for frame in frames]
+    payload = pad(struct.pack(f"<{len(durations)}H", *durations))
+    payload += pad(b''.join(converted[0]))
+    if len(converted) > 1:
+        for i in range(1, len(converted) + 1):
+            payload += delta(converted[i - 1], converted[i % len(converted)])
+
+    header = struct.pack("<IHHBBHI", MAGIC, width, height,
+                         FORMATS.index(pixel_format), 0, len(frames), len(payload))
+    return header + payload
+
+def main(argv):
+    pixel_format : str = "ARGB8888"
+    duration : int = 0
+    usage = "USAGE:\n" + \
+           f"  ./{os.path.basename(__file__)} [OPTIONS] OUTPUT IMAGE [IMAGE [...]]\n" + \
+           f"  IMAGE is a frame or an animated image (GIF, APNG, WebP) holding all frames\n" + \
+           f"OPTIONS:\n" + \
+           f"  -f, --format: pixel format, one of {', '.join(FORMATS)} [default {pixel_format}]\n" + \
+           f"  -d, --duration: duration of every frame in ms [default from the animated image, else 100]"
+    try:
+        opts, remainder = getopt.getopt(argv, "hf:d:", ["help", "format=", "duration="])
+    except getopt.GetoptError:
+        print(usage)
+        sys.exit(1)
+    for opt, arg in opts:
+        if opt in ('-h', '--help'):
+            print(usage)
+            sys.exit(0)
+        elif opt in ('-f', '--format'):
+            if arg not in FORMATS:
+                raise Exception(f"Invalid pixel format {arg}")
+            pixel_format = arg
+        elif opt in ('-d', '--duration'):
+            duration = int(arg)
+
+    if len(remainder) < 2:
+        print(usage)
+        sys.exit(1)
+    output = remainder[0]
+
+    frames, durations = [], []
+    for path in remainder[1:]:
+        if not os.path.isfile(path):
+            raise Exception(f"{os.path.abspath(path)} is not a file")
+        for frame in ImageSequence.Iterator(Image.open(path)):
+            frames.append(frame.convert("RGBA"))
+            durations.append(duration or frame.info.get("duration") or 100)
+
+    blob = compile_animation(frames, durations, pixel_format)
+    with open(output, 'wb') as file:
+        file.write(blob)
+
+    width, height = frames[0].size
+    full = len(frames) * len(pad(b''.join(pixels(frames[0], pixel_format))))
+    print(f"{os.path.basename(output)}: {width}x{height}, {len(frames)} frames, {len(blob)} bytes ({full} as full frames)")
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
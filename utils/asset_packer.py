@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+'''!
+@file
+@company nubix Software-Design GmbH
+@date 2026-10-18
+@brief Pack assets into one blob for AssetPack::load()
+@details The index is sorted by the FNV-1a hash of the asset names, so the
+         firmware finds an asset with a binary search and uses it in place.
+         Assets with equal content are stored once. The data of every asset
+         starts at a multiple of the alignment, at least a word, so the
+         loaders can read it directly from flash.
+'''
+
+import sys, os, getopt, struct, hashlib
+from PIL import Image
+
+MAGIC = 0x4b41504e # "NPAK" read little endian
+FONT_MAGIC = 0x544e464e # "NFNT" read little endian
+
+# same order as enum class AssetType in AssetPack.hpp
+TYPES = ["raw", "sprite", "animation", "video", "font", "level"]
+
+# blobs of these types start with their magic, checked to catch swapped files
+MAGICS = {"sprite": 0x5250534e, "animation": 0x494e414e, "video": 0x4449564e, "font": FONT_MAGIC,
+          "level": 0x4c564c4e}
+
+def hash_name(name : str) -> int:
+    '''
+    32 bit FNV-1a, like AssetPack::hash()
+    '''
+    h = 0x811c9dc5
+    for c in name.encode():
+        h = ((h ^ c) * 0x01000193) & 0xffffffff
+    return h
+
+def compile_font(image : Image.Image) -> bytes:
+    '''
+    FontBlob of a gray image holding the 95 characters side by side, see Font.hpp
+    '''
+    image = image.convert("L")
+    width, height = image.size
+    if width > 0xFFFF or height > 0xFFFF or width < 95:
+        raise Exception("invalid font image size")
+    pixels = image.tobytes()
+    return struct.pack("<IHHI", FONT_MAGIC, width, height, len(pixels)) + pixels
+
+def read_asset(asset_type : str, path : str) -> bytes:
+    with open(path, 'rb') as file:
+        data = file.read()
+    if asset_type == "font" and not data.startswith(struct.pack("<I", FONT_MAGIC)):
+        data = compile_font(Image.open(path))
+    if asset_type in MAGICS and not data.startswith(struct.pack("<I", MAGICS[asset_type])):
+        raise Exception(f"{path} is no {asset_type} blob")
+    return data
+
+def pack(assets : list, align : int) -> tuple:
+    '''
+    Whole pack of (type, name, data) assets; returns the blob and the bytes saved by sharing data
+    '''
+    if align < 4 or align & (align - 1):
+        raise Exception("alignment needs to be a power of two of at least 4")
+    if len(assets) > 0xFFFF:
+        raise Exception("too many assets")
+
+    entries = {}
+    for asset_type, name, data in assets:
+        h = hash_name(name)
+        if h in entries:
+            raise Exception(f"asset {name} collides with {entries[h][1]}")
+        entries[h] = (asset_type, name, data)
+
+    offset = 12 + 16 * len(entries)
+    shared = {} # content hash -> offset
+    index, blob, saved = b'', b'', 0
+    for h in sorted(entries):
+        asset_type, name, data = entries[h]
+        digest = hashlib.sha256(data).digest()
+        if digest in shared:
+            saved += len(data)
+        else:
+            offset += -offset % align
+            blob += bytes(offset - 12 - 16 * len(entries) - len(blob)) + data
+            shared[digest] = offset
+            offset += len(data)
+        index += struct.pack("<IB3xII", h, TYPES.index(asset_type), shared[digest], len(data))
+    blob += bytes(-len(blob) % 4)
+
+    header = struct.pack("<IHHI", MAGIC, len(entries), align, 12 + len(index) + len(blob))
+    return header + index + blob, saved
+
+def main(argv):
+    align : int = 4
+    usage = "USAGE:\n" + \
+           f"  ./{os.path.basename(__file__)} [OPTIONS] OUTPUT TYPE:NAME=PATH [TYPE:NAME=PATH [...]]\n" + \
+           f"  TYPE is one of {', '.join(TYPES)}; a font is a gray image or a font blob\n" + \
+           f"OPTIONS:\n" + \
+           f"  -a, --align: alignment of the data of every asset in bytes [default {align}]"
+    try:
+        opts, remainder = getopt.getopt(argv, "ha:", ["help", "align="])
+    except getopt.GetoptError:
+        print(usage)
+        sys.exit(1)
+    for opt, arg in opts:
+        if opt in ('-h', '--help'):
+            print(usage)
+            sys.exit(0)
+        elif opt in ('-a', '--align'):
+            align = int(arg)
+
+    if len(remainder) < 2:
+        print(usage)
+        sys.exit(1)
+    output = remainder[0]
+
+    assets = []
+    for entry in remainder[1:]:
+        asset_type, _, rest = entry.partition(":")
+        name, _, path = rest.partition("=")
+        if asset_type not in TYPES or not name or not os.path.isfile(path):
+            raise Exception(f"Invalid asset {entry}")
+        assets.append((asset_type, name, read_asset(asset_type, path)))
+
+    blob, saved = pack(assets, align)
+    with open(output, 'wb') as file:
+        file.write(blob)
+    print(f"{os.path.basename(output)}: {len(assets)} assets, {len(blob)} bytes, {saved} bytes shared")
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
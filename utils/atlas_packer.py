@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+'''!
+@file
+@company nubix Software-Design GmbH
+@date 2026-10-18
+@brief Pack images into one sprite atlas blob with a table of sub-rectangles
+@details Images are placed in vertical strips, so an image inside the atlas
+         keeps its columns consecutive in the column-major blob. Writes
+         <NAME>.sprite (see sprite_compiler.py) and <NAME>.hpp with the
+         SpriteRect table.
+'''
+
+import sys, os, getopt
+from PIL import Image
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from sprite_compiler import FORMATS, compile_image
+
+def pack(sizes : list, height : int) -> tuple:
+    '''
+    Place sizes in strips of the given atlas height, widest first
+    Returns the atlas width and the (x, y) of every size
+    '''
+    strips = [] # [x, width, used height]
+    places = [None] * len(sizes)
+    for i in sorted(range(len(sizes)), key=lambda i: (-sizes[i][0], -sizes[i][1])):
+        width, h = sizes[i]
+        for strip in strips:
+            if width <= strip[1] and strip[2] + h <= height:
+                places[i] = (strip[0], strip[2])
+                strip[2] += h
+                break
+        else:
+            x = strips[-1][0] + strips[-1][1] if strips else 0
+            strips.append([x, width, h])
+            places[i] = (x, 0)
+    return strips[-1][0] + strips[-1][1], places
+
+def best_pack(sizes : list) -> tuple:
+    '''
+    Try all atlas heights from the highest image to all images stacked, keep the smallest area
+    '''
+    best = None
+    for height in range(max(h for _, h in sizes), sum(h for _, h in sizes) + 1):
+        width, places = pack(sizes, height)
+        if best is None or width * height < best[0] * best[1]:
+            best = (width, height, places)
+    return best
+
+def header(name : str, names : list, sizes : list, places : list, sources : list) -> str:
+    lines = [f"// Generated by {os.path.basename(__file__)} from {', '.join(sources)}, do not edit",
+             "#pragma once",
+             "",
+             "#include <graphic/Sprite.hpp>",
+             "",
+             "/**",
+             f" * @brief Sprites inside the {name} atlas",
+             " */",
+             f"enum class {name}Rect : int {{"]
+    pad = max(len(n) for n in names) + 2
+    lines += [f"  {'k' + n + ',':<{pad}}  ///< {s}" for n, s in zip(names, sources)]
+    lines += [f"  kCount,",
+              "};",
+              "",
+              "/**",
+              f" * @brief Sub-rectangles of {name}.sprite, indexed with {name}Rect",
+              " */",
+              f"static const SpriteRect k{name}Rects[static_cast<int>({name}Rect::kCount)] = {{"]
+    rects = [f"{{{x}, {y}, {w}, {h}}}," for (w, h), (x, y) in zip(sizes, places)]
+    pad = max(len(r) for r in rects)
+    lines += [f"    {r:<{pad}}  // {n}" for r, n in zip(rects, names)]
+    lines += ["};", ""]
+    return "\n".join(lines)
+
+def main(argv):
+    pixel_format : str = "ARGB8888"
+    encoding : str = "raw"
+    usage = "USAGE:\n" + \
+           f"  ./{os.path.basename(__file__)} [OPTIONS] ATLAS OUTPUT_DIR SPRITE=IMAGE [SPRITE=IMAGE [...]]\n" + \
+           f"OPTIONS:\n" + \
+           f"  -f, --format: pixel format, one of {', '.join(FORMATS)} [default {pixel_format}]\n" + \
+           f"  -r, --rle: run length encode the atlas\n" + \
+           f"  -q, --qoi: encode the atlas with QOI ops"
+    try:
+        opts, remainder = getopt.getopt(argv, "hf:rq", ["help", "format=", "rle", "qoi"])
+    except getopt.GetoptError:
+        print(usage)
+        sys.exit(1)
+    for opt, arg in opts:
+        if opt in ('-h', '--help'):
+            print(usage)
+            sys.exit(0)
+        elif opt in ('-f', '--format'):
+            if arg not in FORMATS:
+                raise Exception(f"Invalid pixel format {arg}")
+            pixel_format = arg
+        elif opt in ('-r', '--rle'):
+            encoding = "rle"
+        elif opt in ('-q', '--qoi'):
+            encoding = "qoi"
+
+    if len(remainder) < 3:
+        print(usage)
+        sys.exit(1)
+    name, output = remainder[0], remainder[1]
+
+    names, paths = [], []
+    for entry in remainder[2:]:
+        sprite, _, path = entry.partition("=")
+        if not sprite or not os.path.isfile(path):
+            raise Exception(f"Invalid image {entry}")
+        names.append(sprite)
+        paths.append(path)
+
+    images = [Image.open(path).convert("RGBA") for path in paths]
+    sizes = [image.size for image in images]
+    width, height, places = best_pack(sizes)
+
+    atlas = Image.new("RGBA", (width, height), (0, 0, 0, 0))
+    for image, place in zip(images, places):
+        atlas.paste(image, place)
+
+    with open(os.path.join(output, name + ".sprite"), 'wb') as file:
+        file.write(compile_image(atlas, pixel_format, encoding))
+    with open(os.path.join(output, name + ".hpp"), 'w') as file:
+        file.write(header(name, names, sizes, places, [os.path.basename(path) for path in paths]))
+
+    used = sum(w * h for w, h in sizes)
+    print(f"{name}: {width}x{height}, {100 * used // (width * height)}% used")
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -4,32 +4,33 @@
 Author Cassiano Silva de Campes
 Date 2023-08-08
 Copyright nubix Software-Design GmbH
+
+Writes the level blob read in place by Level::Load() (Level.hpp): the object
+tables, an array per component (x, y, width, height) with a spatial index each, the texts, the walls and the spawn point of
+the snake. The CSV has the columns name, x, y and text. Besides the objects,
+rows named "Spawn" give the starting point and rows named "Wall" the points of
+the walls, the text names the wall the point belongs to. Without walls, the
+world is surrounded by a rectangle around the objects.
 '''
 
+import sys, os, getopt, struct
 from csv import DictReader
 
-# Define the C-structure template
-struct_typedef = '''\
-typedef struct Coordinate_t {
-  int x;             ///< x-coordinate
-  int y;             ///< y-coordinate
-  bool visible;      ///< is the object visible in viewport
-  bool picked;       ///< was the object picked up (if is pickable)
-  uint8_t width;     ///< width of the object
-  uint8_t height;    ///< height of the object
-  int32_t decay;     ///< alpha decay (if have)
-  const char *text;  ///< Text of the object (if have)
-} Coordinate_t;
-'''
-struct_template = '''\
-static Coordinate_t {name1}[static_cast<int>(WorldObjects::k{name2})] = {{
-        {data}}};
-'''
-size_template = "  k{name} = {size},\n"
+MAGIC = 0x4c564c4e # "NLVL" read little endian
+VERSION = 2 # kLevelVersion
+
+# same order as enum class LevelObject in Level.hpp
+TABLES = ["BlackHoles", "Bumpers", "Headlines", "Boosters", "Collectables", "Pickups",
+          "Decorative_Hexagons", "NubixLogos", "6EArcades", "CButtons", "DButtons",
+          "FadingTextAreas"]
+
+CELL = 128 # kSpatialGridCell
 
-# Read the CSV file and store the coordinates for each name
-coordinates_dict = {}
-structure_sizes = {}
+# kLevelMaxCoins and kLevelMaxTexts, the firmware keeps their state in fixed bit arrays
+LIMITS = {"Collectables": 512, "FadingTextAreas": 32}
+
+# Margins of the world limits around the objects, when the level has no walls
+MARGINS = (-90, -90, 90, 160)
 
 def get_dimmensions(name):
     try:
@@ -52,116 +53,174 @@ def get_dimmensions(name):
     except KeyError:
         return [0, 0]
 
-min_x=float('inf')
-min_y=float('inf')
-max_x=float('-inf')
-max_y=float('-inf')
-
-with open('abc.csv', newline='') as csvfile:
-    reader = DictReader(csvfile)
-    for row in reader:
-        name = row['name']
-        y = 10000 - int((float(row['x']) * 13.27) + 1000)
-        x = int((float(row['y']) * 13.27)  + 1000)
-
-        min_x = min(min_x, x)
-        min_y = min(min_y, y)
-        max_x = max(max_x, x)
-        max_y = max(max_y, y)
-
-        sizeX, sizeY = get_dimmensions(name + "s")
-        text = row['text']
-
-        if not len(text):
-            text = "NULL"
-
-        coordinate = "    {"
-        if text == "NULL":
-            coordinate += f".x={x}, .y={y}, .visible=0, .picked=0, .width={sizeX}, .height={sizeY}, .decay=0, .text={text}"
-        else:
-            if name == "Headline":
-                text_split = text.split("\\n")
-                text = text_split[1]
-
-            coordinate += f".x={x}, .y={y}, .visible=0, .picked=0, .width={sizeX}, .height={sizeY},.decay=0, .text=\"{text}\""
-
-        coordinate += "}"
-
-        if name == "6EArcade":
-            name = "_6EArcade" # Add '_' to not start variable with number
-
-        if name in coordinates_dict:
-            coordinates_dict[name].append(coordinate)
-        else:
-            coordinates_dict[name] = [coordinate]
-
-# Calculate the border bumpers quantity
-#width = abs(min_x - max_x) + 100
-#height = abs(min_y - max_y) + 100
-#num_rows = height // 18
-#num_cols = width // 18
-
-# Calculate structure sizes
-for name, coordinates in coordinates_dict.items():
-    structure_sizes[name] = len(coordinates)
-
-# Generate the C-structure code
-c_struct_code = ""
-c_size_code = ""
-
-for name, coordinates in coordinates_dict.items():
-    data = ",\n".join(coordinates)
-    size = structure_sizes[name]
-    plural = name + "s"
-    c_struct_code += struct_template.format(name1=plural, name2=plural, data=data)
-    c_struct_code += "\n"
-    c_size_code += size_template.format(name=plural, size=size)
-
-# Generate the Corner-bumpers
-corner_coordinates=""
-
-#for row in range(num_rows):
-#  for col in range(num_cols):
-#    x = col * 18
-#    y = col * 18
-#
-#    sizeX, sizeY = get_dimmensions("BorderBumpers")
-#    corner_coordinates += "    {"
-#    corner_coordinates += f".x={x}, .y={y}, .visible=0, .picked=0, .width={sizeX}, .height={sizeY}, .decay=0, .text=NULL"
-#    corner_coordinates +="},"
-#    corner_coordinates += '\n'
-
-#c_struct_code += struct_template.format(name1="BorderBumpers", name2="BorderBumpers", data=corner_coordinates)
-#c_size_code += size_template.format(name="BorderBumpers", size=num_rows * num_cols)
-
-output_filename = "Coordinates.hpp"
-
-with open(output_filename, "w") as output_file:
-    code = f'''\
-#ifndef COORDINATES_H
-#define COORDINATES_H
-
-#include <stdint.h>
-
-#define MIN_X ({min_x})
-#define MIN_Y ({min_y})
-#define MAX_X ({max_x})
-#define MAX_Y ({max_y})
-
-{struct_typedef}
-
-enum class WorldObjects : int {{
-{c_size_code}
-}};
-
-{c_struct_code}
-
-#endif /* COORDINATES_H */
-'''
-    output_file.write(code)
-    print(code)
-
-#c_struct_code += struct_template.format(name1="BorderBumpers", name2="BorderBumpers", data=corner_coordinates)
-#c_struct_code += "\n"
-#c_size_code += size_template.format(name="BorderBumpers", size=num_rows * num_cols)
-#print(c_size_code)
+def pad(data : bytes, align : int = 4) -> bytes:
+    return data + bytes(-len(data) % align)
+
+def point(x : int, y : int) -> bytes:
+    if not -32768 <= x <= 32767 or not -32768 <= y <= 32767:
+        raise Exception(f"point {x}, {y} exceeds 16 bits")
+    return struct.pack("<hh", x, y)
+
+def grid(objects : list) -> bytes:
+    '''
+    SpatialGridBlob_t, cells and items; the same counting sort as SpatialGrid::Build()
+    '''
+    x0 = min(x for x, _, _, _, _ in objects)
+    y0 = min(y for _, y, _, _, _ in objects)
+    columns = (max(x for x, _, _, _, _ in objects) - x0) // CELL + 1
+    rows = (max(y for _, y, _, _, _ in objects) - y0) // CELL + 1
+    if columns * rows > 0xFFFF:
+        raise Exception("world too large for the spatial index")
+
+    cells = [[] for _ in range(columns * rows)]
+    for i, (x, y, _, _, _) in enumerate(objects):
+        cells[(y - y0) // CELL * columns + (x - x0) // CELL].append(i)
+    starts = [0]
+    for cell in cells:
+        starts.append(starts[-1] + len(cell))
+    items = [i for cell in cells for i in cell]
+
+    header = point(x0, y0) + struct.pack("<HHHBB", columns, rows, CELL,
+                                         max(w for _, _, w, _, _ in objects),
+                                         max(h for _, _, _, h, _ in objects))
+    return header + struct.pack(f"<{len(starts)}H", *starts) + struct.pack(f"<{len(items)}H", *items)
+
+def compile_level(objects : dict, walls : list, spawn : tuple) -> bytes:
+    '''
+    Whole level blob; objects maps the names of TABLES to lists of (x, y, width, height, text),
+    walls is a list of point lists
+    '''
+    header_size = 20 + 28 * len(TABLES) + 8 * len(walls)
+    tables = b''
+    wall_headers = b''
+    data = b''
+
+    def append(chunk : bytes) -> int:
+        nonlocal data
+        offset = header_size + len(data)
+        data += pad(chunk)
+        return offset
+
+    for name in TABLES:
+        coordinates = objects.get(name, [])
+        if len(coordinates) > min(0xFFFF, LIMITS.get(name, 0xFFFF)):
+            raise Exception(f"too many {name}")
+        if not coordinates:
+            tables += struct.pack("<IIIIIIHH", 0, 0, 0, 0, 0, 0, 0, 0)
+            continue
+
+        for x, y, width, height, _ in coordinates:
+            point(x, y)
+            if not 0 <= width <= 255 or not 0 <= height <= 255:
+                raise Exception(f"{name} of {width}x{height} exceeds 8 bits")
+        # one array per component, the firmware scans them like columns
+        count = len(coordinates)
+        components = [append(struct.pack(f"<{count}{code}", *(c[i] for c in coordinates)))
+                      for i, code in enumerate("hhBB")]
+
+        texts_offset = 0
+        if any(text is not None for _, _, _, _, text in coordinates):
+            offsets = []
+            for _, _, _, _, text in coordinates:
+                offsets.append(append(text.encode("latin-1") + b'\0') if text is not None else 0)
+            texts_offset = append(struct.pack(f"<{len(offsets)}I", *offsets))
+
+        grid_offset = append(grid(coordinates))
+        tables += struct.pack("<IIIIIIHH", *components, texts_offset, grid_offset, count, 0)
+
+    for points in walls:
+        if len(points) > 0xFFFF:
+            raise Exception("too many points of a wall")
+        for (x1, y1), (x2, y2) in zip(points, points[1:]):
+            if x1 != x2 and y1 != y2:
+                raise Exception(f"wall segment {x1}, {y1} to {x2}, {y2} is neither horizontal nor vertical")
+        offset = append(b''.join(point(x, y) for x, y in points))
+        wall_headers += struct.pack("<IHH", offset, len(points), 0)
+
+    size = header_size + len(data)
+    header = struct.pack("<IHH", MAGIC, VERSION, len(TABLES)) + point(*spawn) + \
+             struct.pack("<HHI", len(walls), 0, size)
+    return header + tables + wall_headers + data
+
+def main(argv):
+    pixels : bool = False
+    usage = "USAGE:\n" + \
+           f"  ./{os.path.basename(__file__)} [OPTIONS] [CSV [OUTPUT]]\n" + \
+           f"  CSV exported from Unity [default abc.csv], OUTPUT level blob [default World.level]\n" + \
+           f"OPTIONS:\n" + \
+           f"  -p, --pixels: x and y of the CSV are world pixels instead of Unity units"
+    try:
+        opts, remainder = getopt.getopt(argv, "hp", ["help", "pixels"])
+    except getopt.GetoptError:
+        print(usage)
+        sys.exit(1)
+    for opt, arg in opts:
+        if opt in ('-h', '--help'):
+            print(usage)
+            sys.exit(0)
+        elif opt in ('-p', '--pixels'):
+            pixels = True
+
+    input_filename = remainder[0] if len(remainder) > 0 else "abc.csv"
+    output_filename = remainder[1] if len(remainder) > 1 else "World.level"
+
+    # Read the CSV file and store the coordinates for each name
+    coordinates_dict = {}
+    walls = {}
+    spawn = None
+
+    with open(input_filename, newline='') as csvfile:
+        reader = DictReader(csvfile)
+        for row in reader:
+            name = row['name']
+            if pixels:
+                x = int(row['x'])
+                y = int(row['y'])
+            else:
+                y = 10000 - int((float(row['x']) * 13.27) + 1000)
+                x = int((float(row['y']) * 13.27)  + 1000)
+
+            if name == "Spawn":
+                spawn = (x, y)
+                continue
+            if name == "Wall":
+                walls.setdefault(row['text'], []).append((x, y))
+                continue
+            if name + "s" not in TABLES:
+                print(f"Ignoring {name} at {x}, {y}")
+                continue
+
+            sizeX, sizeY = get_dimmensions(name + "s")
+            text = row['text']
+
+            if not len(text):
+                text = None
+            else:
+                if name == "Headline" and "\\n" in text:
+                    text_split = text.split("\\n")
+                    text = text_split[1]
+                text = text.replace("\\n", "\n")
+
+            coordinates_dict.setdefault(name + "s", []).append((x, y, sizeX, sizeY, text))
+
+    if spawn is None:
+        raise Exception("The level has no Spawn")
+
+    walls = list(walls.values())
+    if not walls:
+        points = [p[:2] for coordinates in coordinates_dict.values() for p in coordinates]
+        min_x = min(x for x, _ in points) + MARGINS[0]
+        min_y = min(y for _, y in points) + MARGINS[1]
+        max_x = max(x for x, _ in points) + MARGINS[2]
+        max_y = max(y for _, y in points) + MARGINS[3]
+        walls = [[(min_x, min_y), (max_x, min_y), (max_x, max_y), (min_x, max_y), (min_x, min_y)]]
+
+    blob = compile_level(coordinates_dict, walls, spawn)
+    with open(output_filename, "wb") as output_file:
+        output_file.write(blob)
+
+    count = sum(len(coordinates) for coordinates in coordinates_dict.values())
+    print(f"{os.path.basename(output_filename)}: {count} objects, {len(walls)} walls, {len(blob)} bytes")
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * @file physics_benchmark.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief host benchmark and accuracy check of the fixed-point physics of the snake
+ * @details Build and run on the development machine, see utils/README.md
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Physics.hpp"
+
+static const double c_minimumTime = 0.25; // [s] per implementation
+static const int c_frames = 1000;         // frames of the simulated trajectory
+static const int c_objects = 24;          // objects checked for collision per frame
+
+// the float physics the snake used before, with the same calls per operation
+namespace reference
+{
+struct Vector
+{
+    float x, y, angle;
+
+    Vector(float x0 = 1, float y0 = 1) : x(x0), y(y0), angle(std::atan2(y0, x0)) {}
+    float getLength() const { return std::sqrt(x * x + y * y); }
+    float getAngle() const { return std::atan2(y, x); }
+    void setLength(float length)
+    {
+        angle = getAngle();
+        x = length * std::cos(angle);
+        y = length * std::sin(angle);
+    }
+    void setAngle(float radians)
+    {
+        float length = getLength();
+        x = length * std::cos(radians);
+        y = length * std::sin(radians);
+    }
+};
+
+struct Particle
+{
+    int mass = 0;
+    Vector position, velocity;
+
+    Particle(float x, float y) : position(x, y) {}
+    float distanceTo(const Particle &particle) const
+    {
+        float dx = particle.position.x - position.x;
+        float dy = particle.position.y - position.y;
+        return std::sqrt(dx * dx + dy * dy);
+    }
+    void gravitateTo(const Particle &particle)
+    {
+        Vector gravity(1, 0);
+        float distance = distanceTo(particle);
+        float force = particle.mass / (distance * distance);
+        if (force > 3)
+            force = 3;
+        gravity.setLength(force);
+        gravity.setAngle(std::atan2(particle.position.y - position.y, particle.position.x - position.x));
+        velocity.x += gravity.x;
+        velocity.y += gravity.y;
+    }
+};
+} // namespace reference
+
+struct Object
+{
+    int x, y;
+};
+
+static double toDouble(Fixed_t value)
+{
+    return value / (double)kFixedOne;
+}
+
+// repeats run until c_minimumTime passed, returns the time per run in ns
+template <typename Run>
+static double measure(Run run)
+{
+    auto start = std::chrono::steady_clock::now();
+    unsigned int runs = 0;
+    double elapsed;
+
+    do
+    {
+        run();
+        runs++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < c_minimumTime);
+    return elapsed / runs * 1e9;
+}
+
+// one frame of the game like Snake::Update(): speed control and turn of the snake, collision checks and, with gravity, a black hole pull
+static bool frameFloat(reference::Particle &snake, const std::vector<Object> &objects, bool right, bool gravity)
+{
+    const float delta = 2 * M_PI * ToAngle(4) / kAngleTurn;
+    float velocity = snake.velocity.getLength();
+    if (velocity - 1 > 0.1f)
+        snake.velocity.setLength(velocity - 0.1f);
+    else if (velocity - 1 < -0.1f)
+        snake.velocity.setLength(velocity + 0.1f);
+    else
+        snake.velocity.setLength(1);
+    snake.velocity.setAngle(snake.velocity.getAngle() + (right ? delta : -delta));
+    snake.position.x += snake.velocity.x;
+    snake.position.y += snake.velocity.y;
+
+    bool collided = false;
+    for (const Object &object : objects)
+    {
+        reference::Particle p(object.x, object.y);
+        collided |= p.distanceTo(snake) < 9;
+    }
+    reference::Particle hole(objects[0].x, objects[0].y);
+    float distance = hole.distanceTo(snake);
+    if (gravity && distance <= 52)
+    {
+        hole.mass = distance * 2 + 50;
+        snake.gravitateTo(hole);
+    }
+    return collided;
+}
+
+static bool frameFixed(Particle &snake, const std::vector<Object> &objects, bool right, bool gravity)
+{
+    const Fixed_t step = ToFixed(0.1);
+    Fixed_t velocity = snake.GetVelocity().GetLength();
+    if (velocity - kFixedOne > step)
+        snake.GetVelocity().SetLength(velocity - step);
+    else if (velocity - kFixedOne < -step)
+        snake.GetVelocity().SetLength(velocity + step);
+    else
+        snake.GetVelocity().SetLength(kFixedOne);
+    snake.GetVelocity().Rotate(right ? ToAngle(4) : -ToAngle(4));
+    snake.Update();
+
+    bool collided = false;
+    for (const Object &object : objects)
+        collided |= snake.IsCloserThan(object.x, object.y, 9);
+    if (gravity && snake.DistanceSquaredTo(objects[0].x, objects[0].y) <= FixedSquare(52))
+    {
+        Particle hole(objects[0].x, objects[0].y);
+        hole.SetMass(ToInt(hole.DistanceTo(snake)) * 2 + 50);
+        snake.GravitateTo(hole);
+    }
+    return collided;
+}
+
+int main()
+{
+    srand(1);
+
+    // table functions against libm
+    double sinError = 0;
+    for (int a = 0; a < kAngleTurn; a++)
+    {
+        double angle = 2 * M_PI * a / kAngleTurn;
+        sinError = std::fmax(sinError, std::fabs(toDouble(Sin(a)) - std::sin(angle)));
+        sinError = std::fmax(sinError, std::fabs(toDouble(Cos(a)) - std::cos(angle)));
+    }
+
+    double lengthError = 0;
+    for (int i = 0; i < 100000; i++)
+    {
+        Vector v = Vector::FromFixed(rand() % ToFixed(200) - ToFixed(100), rand() % ToFixed(200) - ToFixed(100));
+        double exact = std::hypot(toDouble(v.x_), toDouble(v.y_));
+        lengthError = std::fmax(lengthError, std::fabs(toDouble(v.GetLength()) - exact));
+    }
+
+    // a full circle of turns must keep the length and come back to the start
+    Vector turning = Vector::FromFixed(ToFixed(5), 0);
+    for (int i = 0; i < 100 * kAngleTurn / ToAngle(4); i++)
+        turning.Rotate(ToAngle(4));
+    double turnDrift = std::fabs(toDouble(turning.GetLength()) - 5);
+
+    double gravityError = 0;
+    for (int i = 0; i < 100000; i++)
+    {
+        int x = rand() % 100 - 50, y = rand() % 100 - 50, mass = rand() % 200;
+        if (0 == x && 0 == y)
+            continue;
+        reference::Particle a(x, y), b(0, 0);
+        Particle c(x, y), d(0, 0);
+        a.velocity = reference::Vector(0, 0);
+        c.GetVelocity() = Vector(0, 0);
+        b.mass = mass;
+        d.SetMass(mass);
+        a.gravitateTo(b);
+        c.GravitateTo(d);
+        gravityError = std::fmax(gravityError, std::hypot(toDouble(c.GetVelocity().x_) - a.velocity.x,
+                                                          toDouble(c.GetVelocity().y_) - a.velocity.y));
+    }
+
+    // the same trajectory through a field of objects with both implementations; without the black hole, as its
+    // pull makes the trajectory chaotic: float and double diverge there just like float and fixed-point
+    std::vector<Object> objects;
+    for (int i = 0; i < c_objects; i++)
+        objects.push_back({1000 + rand() % 200 - 100, 1000 + rand() % 200 - 100});
+    std::vector<bool> turns;
+    for (int i = 0; i < c_frames; i++)
+        turns.push_back(rand() & 1);
+
+    reference::Particle snakeFloat(1000, 1100);
+    Particle snakeFixed(1000, 1100);
+    snakeFloat.velocity = reference::Vector(0, -3);
+    snakeFixed.GetVelocity() = Vector(0, -3);
+    double trajectoryError = 0;
+    int collisionMismatches = 0;
+    for (int i = 0; i < c_frames; i++)
+    {
+        bool a = frameFloat(snakeFloat, objects, turns[i], false);
+        bool b = frameFixed(snakeFixed, objects, turns[i], false);
+        collisionMismatches += a != b;
+        trajectoryError = std::fmax(trajectoryError,
+                                    std::hypot(toDouble(snakeFixed.GetPosition().x_) - snakeFloat.position.x,
+                                               toDouble(snakeFixed.GetPosition().y_) - snakeFloat.position.y));
+    }
+
+    printf("sin/cos max error       %.2e (%.2f LSB)\n", sinError, sinError * kFixedOne);
+    printf("length max error        %.2e px\n", lengthError);
+    printf("length drift, 100 turns %.2e px of 5 px\n", turnDrift);
+    printf("gravity max error       %.2e px/frame\n", gravityError);
+    printf("trajectory max error    %.3f px after %d frames, %d collision mismatches\n", trajectoryError, c_frames,
+           collisionMismatches);
+
+    // timing of the frames, restarted from the same state in every run
+    volatile bool sink = false;
+    double floatTime = measure(
+        [&]()
+        {
+            reference::Particle snake(1000, 1100);
+            snake.velocity = reference::Vector(0, -3);
+            for (int i = 0; i < c_frames; i++)
+                sink = frameFloat(snake, objects, turns[i], true);
+        });
+    double fixedTime = measure(
+        [&]()
+        {
+            Particle snake(1000, 1100);
+            snake.GetVelocity() = Vector(0, -3);
+            for (int i = 0; i < c_frames; i++)
+                sink = frameFixed(snake, objects, turns[i], true);
+        });
+    (void)sink;
+    printf("float frame             %8.1f ns\n", floatTime / c_frames);
+    printf("fixed frame             %8.1f ns (%.1fx)\n", fixedTime / c_frames, floatTime / fixedTime);
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * @file sprite_benchmark.cpp
+ * @date 2026-10-18
+ * @version v1.0
+ * @brief host benchmark of sprite blob decoding against pngle
+ * @details Build and run on the development machine, see utils/README.md
+ *
+ * @copyright Copyright (c) 2026 nubix Software-Design GmbH, All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *******************************************************************************/
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <graphic/SpriteDecoder.hpp>
+#include <pngle.h>
+
+// same layout as graphic/Sprite.hpp, which needs the pico SDK
+struct SpriteBlob
+{
+    uint32_t magic;
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;
+    uint8_t encoding;
+    uint16_t reserved;
+    uint32_t size;
+};
+
+static const unsigned int c_bytesPerPixel[] = {4, 4, 2, 2, 1};
+static const double c_minimumTime = 0.25; // [s] per decoder and image
+
+static bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+    FILE *file = fopen(path, "rb");
+
+    if (NULL == file)
+        return false;
+    fseek(file, 0, SEEK_END);
+    data.resize(ftell(file));
+    fseek(file, 0, SEEK_SET);
+    bool ok = fread(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return ok;
+}
+
+// column-major RGBA, the same work PngImage does for a sprite
+static void onRow(pngle_t *pngle, uint32_t x, uint32_t y, uint32_t step, uint32_t n, const uint8_t *rgba)
+{
+    uint8_t *canvas = (uint8_t *)pngle_get_user_data(pngle);
+    uint32_t height = pngle_get_height(pngle);
+
+    for (; n--; x += step, rgba += 4)
+        memcpy(canvas + (x * height + y) * 4, rgba, 4);
+}
+
+// straight RGBA pixel to the little endian bytes of the format, like convert() of sprite_compiler.py
+static unsigned int convert(const uint8_t *rgba, PixelFormat format, uint8_t *out)
+{
+    const uint32_t r = rgba[0], g = rgba[1], b = rgba[2], a = rgba[3];
+    uint32_t value;
+
+    switch (format)
+    {
+    case PixelFormat::ARGB8888:
+        value = a << 24 | r << 16 | g << 8 | b;
+        break;
+    case PixelFormat::ARGB8888Pre:
+        value = a << 24 | (r * a / 255) << 16 | (g * a / 255) << 8 | b * a / 255;
+        break;
+    case PixelFormat::ARGB4444:
+        value = (a >> 4) << 12 | (r >> 4) << 8 | (g >> 4) << 4 | b >> 4;
+        break;
+    case PixelFormat::RGB565:
+        value = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3;
+        break;
+    default: // A8
+        value = a;
+        break;
+    }
+
+    const unsigned int bytes = c_bytesPerPixel[(int)format];
+    for (unsigned int i = 0; i < bytes; i++)
+        out[i] = value >> (8 * i);
+    return bytes;
+}
+
+// compares the decoded sprite with the pngle pixels, returns the index of the first wrong pixel or -1
+static int compare(const std::vector<uint8_t> &canvas, const void *sprite, PixelFormat format, unsigned int pixels)
+{
+    const uint8_t *decoded = (const uint8_t *)sprite;
+    uint8_t expected[4];
+
+    for (unsigned int i = 0; i < pixels; i++)
+    {
+        const unsigned int bytes = convert(&canvas[i * 4], format, expected);
+        if (memcmp(decoded + i * bytes, expected, bytes))
+            return i;
+    }
+    return -1;
+}
+
+// repeats decode until c_minimumTime passed, returns decoded images per second
+template <typename Decode>
+static double measure(Decode decode)
+{
+    auto start = std::chrono::steady_clock::now();
+    unsigned int runs = 0;
+    double elapsed;
+
+    do
+    {
+        if (!decode())
+            return 0;
+        runs++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < c_minimumTime);
+    return runs / elapsed;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3 || 0 == (argc & 1))
+    {
+        printf("USAGE:\n  %s IMAGE.png IMAGE.sprite [IMAGE.png IMAGE.sprite [...]]\n", argv[0]);
+        printf("The sprite blobs are written by sprite_compiler.py, preferably with --qoi\n");
+        return 1;
+    }
+
+    bool failed = false;
+
+    printf("%-24s %9s %8s %8s %8s %11s %11s %7s\n", "image", "size", "raw", "png", "sprite", "png MB/s", "sprite MB/s", "speedup");
+    for (int i = 1; i < argc; i += 2)
+    {
+        std::vector<uint8_t> png, blob;
+
+        if (!readFile(argv[i], png) || !readFile(argv[i + 1], blob) || blob.size() < sizeof(SpriteBlob))
+        {
+            printf("%s: cannot read\n", argv[i]);
+            return 1;
+        }
+
+        SpriteBlob header;
+        memcpy(&header, blob.data(), sizeof(header));
+        if (header.format >= sizeof(c_bytesPerPixel) / sizeof(c_bytesPerPixel[0]) ||
+            blob.size() - sizeof(header) < header.size)
+        {
+            printf("%s: invalid sprite blob\n", argv[i + 1]);
+            return 1;
+        }
+
+        // IHDR follows the signature, the compared pixels need the same size
+        const uint32_t pngWidth = png.size() < 24 ? 0 : png[16] << 24 | png[17] << 16 | png[18] << 8 | png[19];
+        const uint32_t pngHeight = png.size() < 24 ? 0 : png[20] << 24 | png[21] << 16 | png[22] << 8 | png[23];
+        if (pngWidth != header.width || pngHeight != header.height)
+        {
+            printf("%s: size differs from %s\n", argv[i + 1], argv[i]);
+            return 1;
+        }
+
+        const unsigned int pixels = header.width * header.height;
+        const unsigned int raw = pixels * c_bytesPerPixel[header.format];
+        const uint8_t *payload = blob.data() + sizeof(header);
+        std::vector<uint8_t> canvas(pixels * 4);
+        std::vector<uint32_t> sprite((raw + 3) / 4);
+
+        pngle_t *pngle = pngle_new();
+        pngle_set_row_callback(pngle, onRow);
+        double pngRate = measure(
+            [&]()
+            {
+                pngle_reset(pngle);
+                pngle_set_user_data(pngle, canvas.data());
+                return pngle_feed(pngle, png.data(), png.size()) == (int)png.size();
+            });
+        pngle_destroy(pngle);
+
+        SpriteDecoder decoder((PixelFormat)header.format);
+        double spriteRate = measure(
+            [&]()
+            {
+                const uint8_t *src = payload;
+
+                if (0 == header.encoding)
+                {
+                    memcpy(sprite.data(), payload, raw);
+                    return true;
+                }
+                decoder.reset();
+                return 2 == header.encoding && decoder.decode(src, payload + header.size, sprite.data(), pixels) == pixels;
+            });
+
+        // throughput in decoded pixels, counted as 4 bytes each for both decoders
+        const char *name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+        char size[16];
+        snprintf(size, sizeof(size), "%ux%u", header.width, header.height);
+        printf("%-24s %9s %8u %8zu %8u %11.1f %11.1f %6.1fx%s\n", name, size, raw, png.size(), header.size,
+               pngRate * pixels * 4 / 1e6, spriteRate * pixels * 4 / 1e6, pngRate > 0 ? spriteRate / pngRate : 0,
+               0 == pngRate || 0 == spriteRate ? " (decode failed)" : "");
+
+        // both buffers hold the last decoded image, the sprite must show the same pixels
+        int wrong = 0 == pngRate || 0 == spriteRate ? -1 : compare(canvas, sprite.data(), (PixelFormat)header.format, pixels);
+        if (wrong >= 0)
+            printf("%s: pixel %u, %u differs from the png\n", argv[i + 1], wrong / header.height, wrong % header.height);
+        failed = failed || wrong >= 0 || 0 == pngRate || 0 == spriteRate;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+'''!
+@file
+@company nubix Software-Design GmbH
+@date 2026-10-18
+@brief Convert an image into a sprite blob for Sprite::load()
+@details Pixels are stored column by column in the given pixel format, like
+         the FrameBuffer memory, so the blob can be blitted from flash without
+         decoding. The conversion matches Sprite::point().
+'''
+
+import sys, os, getopt, struct
+from PIL import Image
+
+MAGIC = 0x5250534e # "NSPR" read little endian
+
+# same order as enum class PixelFormat in Sprite.hpp
+FORMATS = ["ARGB8888", "ARGB8888Pre", "ARGB4444", "RGB565", "A8"]
+
+# same values as SpriteBlob::encoding
+ENCODINGS = ["raw", "rle", "qoi"]
+
+def channels(pixel : tuple, pixel_format : str) -> tuple:
+    '''
+    Single straight RGBA pixel to the (a, r, g, b) bits stored by the format
+    '''
+    red, green, blue, alpha = pixel
+    if pixel_format == "ARGB8888":
+        return (alpha, red, green, blue)
+    if pixel_format == "ARGB8888Pre":
+        return (alpha, red * alpha // 255, green * alpha // 255, blue * alpha // 255)
+    if pixel_format == "ARGB4444":
+        return (alpha >> 4, red >> 4, green >> 4, blue >> 4)
+    if pixel_format == "RGB565":
+        return (255, red >> 3, green >> 2, blue >> 3)
+    return (255, alpha, alpha, alpha) # A8, gray keeps the diff ops usable
+
+def convert(pixel : tuple, pixel_format : str) -> bytes:
+    '''
+    Single straight RGBA pixel to the little endian bytes of the format
+    '''
+    alpha, red, green, blue = channels(pixel, pixel_format)
+    if pixel_format in ("ARGB8888", "ARGB8888Pre"):
+        return (alpha << 24 | red << 16 | green << 8 | blue).to_bytes(4, "little")
+    if pixel_format == "ARGB4444":
+        return (alpha << 12 | red << 8 | green << 4 | blue).to_bytes(2, "little")
+    if pixel_format == "RGB565":
+        return (red << 11 | green << 5 | blue).to_bytes(2, "little")
+    return bytes([green]) # A8
+
+def run_length_encode(pixels : list) -> bytes:
+    '''
+    Control byte c < 0x80: c + 1 literal pixels follow
+    Control byte c >= 0x80: the next pixel repeats c - 0x7e times (2 to 129)
+    '''
+    out = bytearray()
+    literal = []
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 129 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run > 1:
+            if literal:
+                out += bytes([len(literal) - 1]) + b''.join(literal)
+                literal = []
+            out += bytes([run + 0x7e]) + pixels[i]
+            i += run
+            continue
+        literal.append(pixels[i])
+        if len(literal) == 128:
+            out += bytes([len(literal) - 1]) + b''.join(literal)
+            literal = []
+        i += 1
+    if literal:
+        out += bytes([len(literal) - 1]) + b''.join(literal)
+    return bytes(out)
+
+def qoi_encode(pixels : list) -> bytes:
+    '''
+    QOI ops on (a, r, g, b) channels, decoded by SpriteDecoder
+    '''
+    out = bytearray()
+    index = [(0, 0, 0, 0)] * 64
+    prev = (255, 0, 0, 0)
+    run = 0
+    for px in pixels:
+        if px == prev:
+            run += 1
+            if run == 62:
+                out.append(0xc0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xc0 | (run - 1))
+            run = 0
+        alpha, red, green, blue = px
+        h = (red * 3 + green * 5 + blue * 7 + alpha * 11) % 64
+        if index[h] == px:
+            out.append(h)
+        else:
+            index[h] = px
+            if alpha == prev[0]:
+                # byte wise differences with wrap around, like the decoder adds them
+                dr, dg, db = [((c - p + 128) & 0xff) - 128 for c, p in zip(px[1:], prev[1:])]
+                if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                    out += bytes([0x80 | (dg + 32), (dr - dg + 8) << 4 | (db - dg + 8)])
+                else:
+                    out += bytes([0xfe, red, green, blue])
+            else:
+                out += bytes([0xff, red, green, blue, alpha])
+        prev = px
+    if run:
+        out.append(0xc0 | (run - 1))
+    return bytes(out)
+
+def compile_image(image : Image.Image, pixel_format : str, encoding : str) -> bytes:
+    '''
+    Whole blob of an image: header, pixels and padding to whole words
+    '''
+    image = image.convert("RGBA")
+    width, height = image.size
+    if width > 0xFFFF or height > 0xFFFF:
+        raise Exception("image too large")
+
+    # column-major, like Sprite and the FrameBuffer default layout
+    data = image.load()
+    order = [data[x, y] for x in range(width) for y in range(height)]
+
+    if encoding == "qoi":
+        payload = qoi_encode([channels(pixel, pixel_format) for pixel in order])
+    else:
+        pixels = [convert(pixel, pixel_format) for pixel in order]
+        payload = run_length_encode(pixels) if encoding == "rle" else b''.join(pixels)
+    header = struct.pack("<IHHBBHI", MAGIC, width, height,
+                         FORMATS.index(pixel_format), ENCODINGS.index(encoding), 0, len(payload))
+    return header + payload + bytes(-len(payload) % 4)
+
+def main(argv):
+    pixel_format : str = "ARGB8888"
+    encoding : str = "raw"
+    usage = "USAGE:\n" + \
+           f"  ./{os.path.basename(__file__)} [OPTIONS] INPUT OUTPUT\n" + \
+           f"OPTIONS:\n" + \
+           f"  -f, --format: pixel format, one of {', '.join(FORMATS)} [default {pixel_format}]\n" + \
+           f"  -r, --rle: run length encode the pixels\n" + \
+           f"  -q, --qoi: encode the pixels with QOI ops, see SpriteDecoder"
+    try:
+        opts, remainder = getopt.getopt(argv, "hf:rq", ["help", "format=", "rle", "qoi"])
+    except getopt.GetoptError:
+        print(usage)
+        sys.exit(1)
+    for opt, arg in opts:
+        if opt in ('-h', '--help'):
+            print(usage)
+            sys.exit(0)
+        elif opt in ('-f', '--format'):
+            if arg not in FORMATS:
+                raise Exception(f"Invalid pixel format {arg}")
+            pixel_format = arg
+        elif opt in ('-r', '--rle'):
+            encoding = "rle"
+        elif opt in ('-q', '--qoi'):
+            encoding = "qoi"
+
+    if len(remainder) != 2:
+        print(usage)
+        sys.exit(1)
+    path, output = remainder
+    if not os.path.isfile(path):
+        raise Exception(f"{os.path.abspath(path)} is not a file")
+
+    with open(output, 'wb') as file:
+        file.write(compile_image(Image.open(path), pixel_format, encoding))
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
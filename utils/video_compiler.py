@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+'''!
+@file
+@company nubix Software-Design GmbH
+@date 2026-10-18
+@brief Convert a sequence of images into a video blob for Video::load()
+@details The frames are split into square blocks. Frame 0 holds all blocks,
+         every later frame only the blocks which changed since the frame
+         before, grouped into windows: vertical runs of changed blocks, merged
+         with the neighbouring columns of blocks where the runs match. The
+         pixels of all windows of a frame are encoded with the QOI ops of
+         sprite_compiler.py, column by column inside each window.
+'''
+
+import sys, os, getopt, struct
+from PIL import Image, ImageSequence
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from sprite_compiler import FORMATS, channels, qoi_encode
+
+MAGIC = 0x4449564e # "NVID" read little endian
+
+# formats without transparency, the display shows the pixels as they are
+VIDEO_FORMATS = ["RGB565", "ARGB8888"]
+
+def pad(data : bytes) -> bytes:
+    return data + bytes(-len(data) % 4)
+
+def columns(image : Image.Image, pixel_format : str) -> list:
+    '''
+    Pixels of the format as a list of columns, like Sprite and the FrameBuffer default layout
+    '''
+    width, height = image.size
+    data = image.convert("RGB").convert("RGBA").load()
+    return [[channels(data[x, y], pixel_format) for y in range(height)] for x in range(width)]
+
+def changed_blocks(shown : list, frame : list, block : int, tolerance : int) -> list:
+    '''
+    Per column of blocks the set of block rows which differ by more than tolerance in a channel
+    '''
+    width, height = len(frame), len(frame[0])
+    blocks = []
+    for bx in range((width + block - 1) // block):
+        rows = set()
+        for x in range(bx * block, min(width, (bx + 1) * block)):
+            for y in range(height):
+                if shown is None or \
+                   max(abs(c - s) for c, s in zip(frame[x][y], shown[x][y])) > tolerance:
+                    rows.add(y // block)
+        blocks.append(rows)
+    return blocks
+
+def windows(blocks : list) -> list:
+    '''
+    (x, y, width, height) in blocks; vertical runs, merged with the next columns of equal runs
+    '''
+    runs = []
+    for rows in blocks:
+        column = []
+        for row in sorted(rows):
+            if column and column[-1][0] + column[-1][1] == row:
+                column[-1][1] += 1
+            else:
+                column.append([row, 1])
+        runs.append([tuple(run) for run in column])
+    out = []
+    open_windows = {} # run -> index in out of the window ending at the column before
+    for bx, column in enumerate(runs):
+        current = {}
+        for run in column:
+            if run in open_windows:
+                i = open_windows[run]
+                out[i] = (out[i][0], out[i][1], out[i][2] + 1, out[i][3])
+            else:
+                i = len(out)
+                out.append((bx, run[0], 1, run[1]))
+            current[run] = i
+        open_windows = current
+    return out
+
+def compile_frame(shown : list, frame : list, block : int, tolerance : int) -> bytes:
+    '''
+    VideoFrame, windows and encoded pixels of a frame; updates shown to the displayed pixels
+    '''
+    width, height = len(frame), len(frame[0])
+    areas = windows(changed_blocks(shown, frame, block, tolerance))
+    pixels = []
+    out = b''
+    for bx, by, bw, bh in areas:
+        if bx > 0xFF or by > 0xFF or bw > 0xFF or bh > 0xFF:
+            raise Exception("video too large for the block size")
+        out += struct.pack("<BBBB", bx, by, bw, bh)
+        for x in range(bx * block, min(width, (bx + bw) * block)):
+            top, bottom = by * block, min(height, (by + bh) * block)
+            pixels += frame[x][top:bottom]
+            if shown is not None:
+                shown[x][top:bottom] = frame[x][top:bottom]
+    encoded = qoi_encode(pixels)
+    return pad(struct.pack("<HHI", len(areas), 0, len(encoded)) + out + encoded)
+
+def compile_video(frames : list, period_us : int, pixel_format : str, block : int, tolerance : int) -> bytes:
+    '''
+    Whole blob of a video: header and frames
+    '''
+    width, height = frames[0].size
+    if width > 0xFFFF or height > 0xFFFF or len(frames) > 0xFFFF:
+        raise Exception("video too large")
+    if any(frame.size != frames[0].size for frame in frames):
+        raise Exception("all frames need the same size")
+    if block < 1 or block > 0xFF or period_us < 1:
+        raise Exception("invalid block size or frame rate")
+
+    payload = b''
+    shown = None
+    for frame in frames:
+        pixels = columns(frame, pixel_format)
+        payload += compile_frame(shown, pixels, block, tolerance)
+        if shown is None:
+            shown = pixels # frame 0 shows everything
+
+    header = struct.pack("<IHHBBHII", MAGIC, width, height, FORMATS.index(pixel_format),
+                         block, len(frames), period_us, len(payload))
+    return header + payload
+
+def main(argv):
+    pixel_format : str = "RGB565"
+    fps : float = 30
+    block : int = 8
+    tolerance : int = 0
+    usage = "USAGE:\n" + \
+           f"  ./{os.path.basename(__file__)} [OPTIONS] OUTPUT IMAGE [IMAGE [...]]\n" + \
+           f"  IMAGE is a frame or an animated image (GIF, APNG, WebP) holding frames\n" + \
+           f"OPTIONS:\n" + \
+           f"  -f, --format: pixel format, one of {', '.join(VIDEO_FORMATS)} [default {pixel_format}]\n" + \
+           f"  -r, --rate: frames per second [default {fps}]\n" + \
+           f"  -b, --block: edge of the blocks in pixels [default {block}]\n" + \
+           f"  -t, --tolerance: largest channel difference of an unchanged block, in bits of\n" + \
+           f"                   the format [default {tolerance}, lossless]"
+    try:
+        opts, remainder = getopt.getopt(argv, "hf:r:b:t:", ["help", "format=", "rate=", "block=", "tolerance="])
+    except getopt.GetoptError:
+        print(usage)
+        sys.exit(1)
+    for opt, arg in opts:
+        if opt in ('-h', '--help'):
+            print(usage)
+            sys.exit(0)
+        elif opt in ('-f', '--format'):
+            if arg not in VIDEO_FORMATS:
+                raise Exception(f"Invalid pixel format {arg}")
+            pixel_format = arg
+        elif opt in ('-r', '--rate'):
+            fps = float(arg)
+        elif opt in ('-b', '--block'):
+            block = int(arg)
+        elif opt in ('-t', '--tolerance'):
+            tolerance = int(arg)
+
+    if len(remainder) < 2:
+        print(usage)
+        sys.exit(1)
+    output = remainder[0]
+
+    frames = []
+    for path in remainder[1:]:
+        if not os.path.isfile(path):
+            raise Exception(f"{os.path.abspath(path)} is not a file")
+        frames += [frame.convert("RGBA") for frame in ImageSequence.Iterator(Image.open(path))]
+
+    blob = compile_video(frames, round(1000000 / fps), pixel_format, block, tolerance)
+    with open(output, 'wb') as file:
+        file.write(blob)
+
+    width, height = frames[0].size
+    print(f"{os.path.basename(output)}: {width}x{height}, {len(frames)} frames at {fps} fps, {len(blob)} bytes")
+
+if __name__ == '__main__':
+    main(sys.argv[1:])